@@ -0,0 +1,192 @@
+#include "Benchmark.h"
+
+#include "Matrix4f.h"
+#include "Vector3f.h"
+#include "Vector4f.h"
+#include "Vector3fSoA.h"
+#include "Frustum.h"
+#include "Bounds.h"
+#include "TransformHierarchy.h"
+
+#include <vector>
+
+#ifdef GDT_NAMESPACE
+using namespace GDT;
+#endif
+
+// Pairs of benchmarks doing the same work per iteration, once through
+// single calls and once through the batch or structure-of-arrays API.
+// The batch versions run on the SIMD backend, so comparing a pair shows
+// the gain of the vectorized path. Building with GDT_SIMD=NONE and
+// diffing the JSON output compares the backends themselves.
+namespace
+{
+    const size_t SMALL = 1 << 10;
+    const size_t LARGE = 1 << 20;
+
+    Matrix4f viewMatrix()
+    {
+        Matrix4f m;
+        m.rotate(30, 1, 0, 0);
+        m.rotate(45, 0, 1, 0);
+        m.translate(Vector3f(-4, -2, 10));
+        return m;
+    }
+
+    std::vector<Vector3f> points(size_t count)
+    {
+        std::vector<Vector3f> v(count);
+        for (size_t i = 0; i < count; i++)
+            v[i] = Vector3f((float) (i % 97), (float) (i % 89) - 40, (float) (i % 83) + 1);
+        return v;
+    }
+
+    void transformPointsSingle(size_t count, size_t iterations)
+    {
+        Matrix4f m = viewMatrix();
+        std::vector<Vector3f> in = points(count);
+        std::vector<Vector3f> out(count);
+        for (size_t i = 0; i < iterations; i++)
+        {
+            for (size_t j = 0; j < count; j++)
+                out[j] = m.transform(in[j], 1);
+            Benchmark::doNotOptimize(out[0]);
+        }
+    }
+
+    void transformPointsBatch(size_t count, size_t iterations)
+    {
+        Matrix4f m = viewMatrix();
+        std::vector<Vector3f> in = points(count);
+        std::vector<Vector3f> out(count);
+        for (size_t i = 0; i < iterations; i++)
+        {
+            m.transformPoints(in.data(), out.data(), count);
+            Benchmark::doNotOptimize(out[0]);
+        }
+    }
+
+    void transformVector4fSingle(size_t count, size_t iterations)
+    {
+        Matrix4f m = viewMatrix();
+        std::vector<Vector4f> in(count, Vector4f(1, 2, 3, 1));
+        std::vector<Vector4f> out(count);
+        for (size_t i = 0; i < iterations; i++)
+        {
+            for (size_t j = 0; j < count; j++)
+                out[j] = m * in[j];
+            Benchmark::doNotOptimize(out[0]);
+        }
+    }
+
+    void transformVector4fBatch(size_t count, size_t iterations)
+    {
+        Matrix4f m = viewMatrix();
+        std::vector<Vector4f> in(count, Vector4f(1, 2, 3, 1));
+        std::vector<Vector4f> out(count);
+        for (size_t i = 0; i < iterations; i++)
+        {
+            m.transform(in.data(), out.data(), count);
+            Benchmark::doNotOptimize(out[0]);
+        }
+    }
+
+    BENCHMARK("Batch/transformPoints/single/1024", [](size_t iterations) { transformPointsSingle(SMALL, iterations); });
+    BENCHMARK("Batch/transformPoints/batch/1024", [](size_t iterations) { transformPointsBatch(SMALL, iterations); });
+    BENCHMARK("Batch/transformPoints/single/1M", [](size_t iterations) { transformPointsSingle(LARGE, iterations); });
+    BENCHMARK("Batch/transformPoints/batch/1M", [](size_t iterations) { transformPointsBatch(LARGE, iterations); });
+    BENCHMARK("Batch/transformVector4f/single/1024", [](size_t iterations) { transformVector4fSingle(SMALL, iterations); });
+    BENCHMARK("Batch/transformVector4f/batch/1024", [](size_t iterations) { transformVector4fBatch(SMALL, iterations); });
+
+    BENCHMARK("Batch/normalize/Vector3f/1024", [](size_t iterations) {
+        std::vector<Vector3f> in = points(SMALL);
+        std::vector<Vector3f> out(SMALL);
+        for (size_t i = 0; i < iterations; i++)
+        {
+            for (size_t j = 0; j < SMALL; j++)
+                out[j] = normalize(in[j]);
+            Benchmark::doNotOptimize(out[0]);
+        }
+    });
+
+    BENCHMARK("Batch/normalize/Vector3fSoA/1024", [](size_t iterations) {
+        Vector3fSoA in(points(SMALL));
+        Vector3fSoA out(SMALL);
+        for (size_t i = 0; i < iterations; i++)
+        {
+            normalize(in, out);
+            Benchmark::doNotOptimize(out.x[0]);
+        }
+    });
+
+    BENCHMARK("Batch/dot/Vector3f/1024", [](size_t iterations) {
+        std::vector<Vector3f> v1 = points(SMALL);
+        std::vector<Vector3f> v2 = points(SMALL);
+        std::vector<float> out(SMALL);
+        for (size_t i = 0; i < iterations; i++)
+        {
+            for (size_t j = 0; j < SMALL; j++)
+                out[j] = dot(v1[j], v2[j]);
+            Benchmark::doNotOptimize(out[0]);
+        }
+    });
+
+    BENCHMARK("Batch/dot/Vector3fSoA/1024", [](size_t iterations) {
+        Vector3fSoA v1(points(SMALL));
+        Vector3fSoA v2(points(SMALL));
+        AlignedFloatArray out;
+        for (size_t i = 0; i < iterations; i++)
+        {
+            dot(v1, v2, out);
+            Benchmark::doNotOptimize(out[0]);
+        }
+    });
+
+    BENCHMARK("Batch/cullBoxes/single/1024", [](size_t iterations) {
+        Frustum frustum(viewMatrix());
+        std::vector<Vector3f> centers = points(SMALL);
+        std::vector<AABB> boxes;
+        for (const Vector3f& c : centers)
+            boxes.push_back(AABB(c - 1, c + 1));
+
+        std::vector<uint32_t> mask((SMALL + 31) / 32);
+        for (size_t i = 0; i < iterations; i++)
+        {
+            for (size_t j = 0; j < SMALL; j++)
+            {
+                if (frustum.intersects(boxes[j]))
+                    mask[j / 32] |= 1u << (j % 32);
+            }
+            Benchmark::doNotOptimize(mask[0]);
+        }
+    });
+
+    BENCHMARK("Batch/cullBoxes/batch/1024", [](size_t iterations) {
+        Frustum frustum(viewMatrix());
+        Vector3fSoA centers(points(SMALL));
+        Vector3fSoA extents(std::vector<Vector3f>(SMALL, Vector3f(1)));
+
+        std::vector<uint32_t> mask;
+        for (size_t i = 0; i < iterations; i++)
+        {
+            frustum.cullBoxes(centers, extents, mask);
+            Benchmark::doNotOptimize(mask[0]);
+        }
+    });
+
+    // A wide hierarchy of four levels where one node in twenty moves every frame
+    BENCHMARK("Batch/TransformHierarchy/update/256k", [](size_t iterations) {
+        TransformHierarchy hierarchy;
+        for (size_t i = 0; i < (1 << 18); i++)
+            hierarchy.addNode(i % 64 == 0 ? TransformHierarchy::NO_PARENT : i - 1 - i % 4);
+        hierarchy.update();
+
+        for (size_t i = 0; i < iterations; i++)
+        {
+            for (size_t j = i % 20; j < hierarchy.size(); j += 20)
+                hierarchy.setTranslation(j, Vector3f((float) i));
+            hierarchy.update();
+            Benchmark::doNotOptimize(hierarchy.getWorldMatrices()[0]);
+        }
+    });
+}
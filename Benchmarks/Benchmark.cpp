@@ -0,0 +1,178 @@
+#include "Benchmark.h"
+
+#include "Simd.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+
+namespace Benchmark
+{
+    namespace
+    {
+        struct Entry
+        {
+            std::string name;
+            Function function;
+        };
+
+        // Function-local so registrations from other translation units find it constructed
+        std::vector<Entry>& registry()
+        {
+            static std::vector<Entry> entries;
+            return entries;
+        }
+
+        const double MIN_RUN_SECONDS = 0.2;
+
+        double timeRun(const Function& function, size_t iterations)
+        {
+            auto start = std::chrono::steady_clock::now();
+            function(iterations);
+            auto end = std::chrono::steady_clock::now();
+
+            return std::chrono::duration<double>(end - start).count();
+        }
+
+        const char* simdBackend()
+        {
+#if defined(GDT_SIMD_AVX)
+            return "AVX";
+#elif defined(GDT_SIMD_SSE)
+            return "SSE";
+#elif defined(GDT_SIMD_NEON)
+            return "NEON";
+#else
+            return "NONE";
+#endif
+        }
+
+        const char* compiler()
+        {
+#if defined(__clang__)
+            return "clang " __clang_version__;
+#elif defined(__GNUC__)
+            return "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+#define BENCHMARK_STRINGIFY_IMPL(x) #x
+#define BENCHMARK_STRINGIFY(x) BENCHMARK_STRINGIFY_IMPL(x)
+            return "msvc " BENCHMARK_STRINGIFY(_MSC_FULL_VER);
+#else
+            return "unknown";
+#endif
+        }
+
+        std::string escape(const std::string& s)
+        {
+            std::string escaped;
+            for (char c : s)
+            {
+                if (c == '"' || c == '\\')
+                    escaped += '\\';
+                escaped += c;
+            }
+            return escaped;
+        }
+    }
+
+    Registration::Registration(const char* name, Function function)
+    {
+        registry().push_back(Entry{ name, function });
+    }
+
+    std::vector<Result> runAll(const std::string& filter)
+    {
+        std::vector<Result> results;
+
+        printf("%-48s %14s %14s\n", "Benchmark", "ns/iteration", "iterations");
+        for (const Entry& entry : registry())
+        {
+            if (entry.name.find(filter) == std::string::npos)
+                continue;
+
+            size_t iterations = 1;
+            double seconds = timeRun(entry.function, iterations);
+            while (seconds < MIN_RUN_SECONDS)
+            {
+                iterations *= seconds < MIN_RUN_SECONDS / 100 ? 10 : 2;
+                seconds = timeRun(entry.function, iterations);
+            }
+
+            Result result = { entry.name, iterations, seconds * 1e9 / iterations };
+            printf("%-48s %14.2f %14zu\n", result.name.c_str(), result.nanoseconds, result.iterations);
+            results.push_back(result);
+        }
+        return results;
+    }
+
+    bool writeJson(const std::string& path, const std::vector<Result>& results)
+    {
+        FILE* file = fopen(path.c_str(), "w");
+        if (file == nullptr)
+            return false;
+
+        char date[32];
+        time_t now = time(nullptr);
+        strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", localtime(&now));
+
+        fprintf(file, "{\n  \"context\": {\n");
+        fprintf(file, "    \"date\": \"%s\",\n", date);
+        fprintf(file, "    \"simd\": \"%s\",\n", simdBackend());
+#ifdef GDT_ALIGNED_MATRIX
+        fprintf(file, "    \"aligned_matrix\": true,\n");
+#else
+        fprintf(file, "    \"aligned_matrix\": false,\n");
+#endif
+#ifdef NDEBUG
+        fprintf(file, "    \"build_type\": \"release\",\n");
+#else
+        fprintf(file, "    \"build_type\": \"debug\",\n");
+#endif
+        fprintf(file, "    \"compiler\": \"%s\"\n", escape(compiler()).c_str());
+        fprintf(file, "  },\n  \"benchmarks\": [\n");
+
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            const Result& result = results[i];
+            fprintf(file, "    {\n");
+            fprintf(file, "      \"name\": \"%s\",\n", escape(result.name).c_str());
+            fprintf(file, "      \"run_type\": \"iteration\",\n");
+            fprintf(file, "      \"iterations\": %zu,\n", result.iterations);
+            fprintf(file, "      \"real_time\": %.4f,\n", result.nanoseconds);
+            fprintf(file, "      \"cpu_time\": %.4f,\n", result.nanoseconds);
+            fprintf(file, "      \"time_unit\": \"ns\"\n");
+            fprintf(file, "    }%s\n", i + 1 < results.size() ? "," : "");
+        }
+
+        fprintf(file, "  ]\n}\n");
+        return fclose(file) == 0;
+    }
+}
+
+/**
+ * Usage: GDTBenchmarks [filter] [--json <file>]
+ */
+int main(int argc, char** argv)
+{
+    std::string filter;
+    std::string jsonPath;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--json") == 0 && i + 1 < argc)
+            jsonPath = argv[++i];
+        else
+            filter = argv[i];
+    }
+
+    std::vector<Benchmark::Result> results = Benchmark::runAll(filter);
+
+    if (!jsonPath.empty() && !Benchmark::writeJson(jsonPath, results))
+    {
+        fprintf(stderr, "Failed to write %s\n", jsonPath.c_str());
+        return 1;
+    }
+
+    return results.empty() ? 1 : 0;
+}
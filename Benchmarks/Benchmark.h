@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+/**
+ * Minimal benchmark harness. Benchmarks register themselves through the
+ * BENCHMARK macro and receive the number of iterations to run, which the
+ * harness grows until a run takes long enough to time reliably.
+ */
+namespace Benchmark
+{
+    typedef std::function<void(size_t iterations)> Function;
+
+    struct Registration
+    {
+        Registration(const char* name, Function function);
+    };
+
+    struct Result
+    {
+        std::string name;
+        size_t iterations;
+        double nanoseconds;
+    };
+
+    /**
+     * Keeps the compiler from optimizing away the computation of a value
+     */
+    template<typename T>
+    inline void doNotOptimize(const T& value)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        static volatile const void* sink;
+        sink = &value;
+#endif
+    }
+
+    /**
+     * Runs all registered benchmarks whose name contains the filter and
+     * prints a table of the results
+     *
+     * @return the results in registration order
+     */
+    std::vector<Result> runAll(const std::string& filter);
+
+    /**
+     * Writes results in the JSON layout of Google Benchmark, so the output
+     * of two builds can be compared with its tools or a plain diff. The
+     * context records the SIMD backend the library was compiled with.
+     *
+     * @return false if the file could not be written
+     */
+    bool writeJson(const std::string& path, const std::vector<Result>& results);
+}
+
+#define BENCHMARK_CONCAT_IMPL(a, b) a##b
+#define BENCHMARK_CONCAT(a, b) BENCHMARK_CONCAT_IMPL(a, b)
+#define BENCHMARK(name, function) \
+    static Benchmark::Registration BENCHMARK_CONCAT(benchmarkRegistration, __LINE__)(name, function)
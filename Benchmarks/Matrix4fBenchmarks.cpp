@@ -0,0 +1,191 @@
+#include "Benchmark.h"
+
+#include "Matrix4f.h"
+#include "Vector3f.h"
+#include "Vector4f.h"
+#include "Quaternionf.h"
+
+#ifdef GDT_NAMESPACE
+using namespace GDT;
+#endif
+
+namespace
+{
+    // A typical camera matrix, rotated and translated only
+    Matrix4f viewMatrix()
+    {
+        Matrix4f m;
+        m.rotate(30, 1, 0, 0);
+        m.rotate(45, 0, 1, 0);
+        m.translate(Vector3f(-4, -2, 10));
+        return m;
+    }
+
+    BENCHMARK("Matrix4f/inverse", [](size_t iterations) {
+        Matrix4f m = viewMatrix();
+        for (size_t i = 0; i < iterations; i++)
+        {
+            Benchmark::doNotOptimize(m);
+            Benchmark::doNotOptimize(inverse(m));
+        }
+    });
+
+    BENCHMARK("Matrix4f/inverseAffine", [](size_t iterations) {
+        Matrix4f m = viewMatrix();
+        for (size_t i = 0; i < iterations; i++)
+        {
+            Benchmark::doNotOptimize(m);
+            Benchmark::doNotOptimize(inverseAffine(m));
+        }
+    });
+
+    BENCHMARK("Matrix4f/inverseRigid", [](size_t iterations) {
+        Matrix4f m = viewMatrix();
+        for (size_t i = 0; i < iterations; i++)
+        {
+            Benchmark::doNotOptimize(m);
+            Benchmark::doNotOptimize(inverseRigid(m));
+        }
+    });
+
+    BENCHMARK("Matrix4f/determinant", [](size_t iterations) {
+        Matrix4f m = viewMatrix();
+        for (size_t i = 0; i < iterations; i++)
+        {
+            Benchmark::doNotOptimize(m);
+            Benchmark::doNotOptimize(determinant(m));
+        }
+    });
+
+    BENCHMARK("Matrix4f/multiply", [](size_t iterations) {
+        Matrix4f m = viewMatrix();
+        Matrix4f p = viewMatrix();
+        for (size_t i = 0; i < iterations; i++)
+        {
+            Benchmark::doNotOptimize(m);
+            Benchmark::doNotOptimize(m * p);
+        }
+    });
+
+    BENCHMARK("Matrix4f/multiplyVector4f", [](size_t iterations) {
+        Matrix4f m = viewMatrix();
+        Vector4f v(1, 2, 3, 1);
+        for (size_t i = 0; i < iterations; i++)
+        {
+            Benchmark::doNotOptimize(v);
+            Benchmark::doNotOptimize(m * v);
+        }
+    });
+
+    BENCHMARK("Matrix4f/translate", [](size_t iterations) {
+        Matrix4f m = viewMatrix();
+        Vector3f t(0.5f, 0.25f, 0.125f);
+        for (size_t i = 0; i < iterations; i++)
+        {
+            Benchmark::doNotOptimize(t);
+            m.translate(t);
+        }
+        Benchmark::doNotOptimize(m);
+    });
+
+    BENCHMARK("Matrix4f/identity", [](size_t iterations) {
+        for (size_t i = 0; i < iterations; i++)
+        {
+            Matrix4f m;
+            Benchmark::doNotOptimize(m);
+        }
+    });
+
+    BENCHMARK("Matrix4f/multiplyVector3f", [](size_t iterations) {
+        Matrix4f m = viewMatrix();
+        Vector3f v(1, 2, 3);
+        for (size_t i = 0; i < iterations; i++)
+        {
+            Benchmark::doNotOptimize(v);
+            Benchmark::doNotOptimize(m * v);
+        }
+    });
+
+    BENCHMARK("Matrix4f/transformPoint", [](size_t iterations) {
+        Matrix4f m = viewMatrix();
+        Vector3f v(1, 2, 3);
+        for (size_t i = 0; i < iterations; i++)
+        {
+            Benchmark::doNotOptimize(v);
+            Benchmark::doNotOptimize(m.transform(v, 1));
+        }
+    });
+
+    BENCHMARK("Matrix4f/setIdentity", [](size_t iterations) {
+        Matrix4f m = viewMatrix();
+        for (size_t i = 0; i < iterations; i++)
+        {
+            m.setIdentity();
+            Benchmark::doNotOptimize(m);
+        }
+    });
+
+    BENCHMARK("Matrix4f/rotateAxisAngle", [](size_t iterations) {
+        Matrix4f m;
+        float angle = 0.001f;
+        for (size_t i = 0; i < iterations; i++)
+        {
+            Benchmark::doNotOptimize(angle);
+            m.rotate(angle, 0, 1, 0);
+        }
+        Benchmark::doNotOptimize(m);
+    });
+
+    BENCHMARK("Matrix4f/rotateEuler", [](size_t iterations) {
+        Matrix4f m;
+        Vector3f euler(0.001f, 0.002f, 0.003f);
+        for (size_t i = 0; i < iterations; i++)
+        {
+            Benchmark::doNotOptimize(euler);
+            m.rotate(euler);
+        }
+        Benchmark::doNotOptimize(m);
+    });
+
+    BENCHMARK("Matrix4f/rotateQuaternion", [](size_t iterations) {
+        Matrix4f m;
+        Quaternionf q = Quaternionf::fromEuler(Vector3f(0.001f, 0.002f, 0.003f));
+        for (size_t i = 0; i < iterations; i++)
+        {
+            Benchmark::doNotOptimize(q);
+            m.rotate(q);
+        }
+        Benchmark::doNotOptimize(m);
+    });
+
+    BENCHMARK("Matrix4f/scale", [](size_t iterations) {
+        Matrix4f m = viewMatrix();
+        Vector3f s(1.0001f, 0.9999f, 1);
+        for (size_t i = 0; i < iterations; i++)
+        {
+            Benchmark::doNotOptimize(s);
+            m.scale(s);
+        }
+        Benchmark::doNotOptimize(m);
+    });
+
+    BENCHMARK("Matrix4f/transpose", [](size_t iterations) {
+        Matrix4f m = viewMatrix();
+        for (size_t i = 0; i < iterations; i++)
+        {
+            Benchmark::doNotOptimize(m);
+            Benchmark::doNotOptimize(transpose(m));
+        }
+    });
+
+    BENCHMARK("Matrix4f/compose", [](size_t iterations) {
+        Vector3f t(1, 2, 3);
+        Quaternionf q = Quaternionf::fromEuler(Vector3f(30, 45, 60));
+        Vector3f s(2);
+        for (size_t i = 0; i < iterations; i++)
+        {
+            Benchmark::doNotOptimize(q);
+            Benchmark::doNotOptimize(compose(t, q, s));
+        }
+    });
+}
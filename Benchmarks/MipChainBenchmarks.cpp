@@ -0,0 +1,49 @@
+#include "Benchmark.h"
+
+#include "MipChain.h"
+
+#include <vector>
+
+#ifdef GDT_NAMESPACE
+using namespace GDT;
+#endif
+
+// Full mip chains of a noisy RGBA8 image. Building with GDT_SIMD=NONE and
+// diffing the JSON output shows the gain of filtering on the SIMD backend.
+namespace
+{
+    const uint SIZE = 1024;
+
+    std::vector<unsigned char> image()
+    {
+        std::vector<unsigned char> pixels((size_t) SIZE * SIZE * 4);
+        for (size_t i = 0; i < pixels.size(); i++)
+            pixels[i] = (unsigned char) ((i * 2654435761u) >> 24);
+        return pixels;
+    }
+
+    void generate(const MipOptions& options, size_t iterations)
+    {
+        std::vector<unsigned char> pixels = image();
+        MipChain chain;
+        for (size_t i = 0; i < iterations; i++)
+        {
+            chain.generate(pixels.data(), SIZE, SIZE, options);
+            Benchmark::doNotOptimize(chain.getLevel(1).pixels[0]);
+        }
+    }
+
+    MipOptions options(MipFilter filter, bool sRGB, float alphaCoverage)
+    {
+        MipOptions options;
+        options.filter = filter;
+        options.sRGB = sRGB;
+        options.alphaCoverage = alphaCoverage;
+        return options;
+    }
+
+    BENCHMARK("MipChain/box/1024", [](size_t iterations) { generate(options(MipFilter::BOX, false, 0), iterations); });
+    BENCHMARK("MipChain/box/sRGB/1024", [](size_t iterations) { generate(options(MipFilter::BOX, true, 0), iterations); });
+    BENCHMARK("MipChain/kaiser/1024", [](size_t iterations) { generate(options(MipFilter::KAISER, false, 0), iterations); });
+    BENCHMARK("MipChain/box/alphaCoverage/1024", [](size_t iterations) { generate(options(MipFilter::BOX, false, 0.5f), iterations); });
+}
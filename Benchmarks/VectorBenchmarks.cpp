@@ -0,0 +1,207 @@
+#include "Benchmark.h"
+
+#include "Vector2f.h"
+#include "Vector3f.h"
+#include "Vector4f.h"
+#include "Maths.h"
+
+#ifdef GDT_NAMESPACE
+using namespace GDT;
+#endif
+
+namespace
+{
+    BENCHMARK("Vector2f/add", [](size_t iterations) {
+        Vector2f v(1, 2);
+        Vector2f d(0.5f, 0.25f);
+        for (size_t i = 0; i < iterations; i++)
+        {
+            Benchmark::doNotOptimize(d);
+            v = v + d;
+        }
+        Benchmark::doNotOptimize(v);
+    });
+
+    BENCHMARK("Vector3f/add", [](size_t iterations) {
+        Vector3f v(1, 2, 3);
+        Vector3f d(0.5f, 0.25f, 0.125f);
+        for (size_t i = 0; i < iterations; i++)
+        {
+            Benchmark::doNotOptimize(d);
+            v = v + d;
+        }
+        Benchmark::doNotOptimize(v);
+    });
+
+    BENCHMARK("Vector3f/dot", [](size_t iterations) {
+        Vector3f v1(1, 2, 3);
+        Vector3f v2(4, 5, 6);
+        for (size_t i = 0; i < iterations; i++)
+        {
+            Benchmark::doNotOptimize(v1);
+            Benchmark::doNotOptimize(dot(v1, v2));
+        }
+    });
+
+    BENCHMARK("Vector3f/cross", [](size_t iterations) {
+        Vector3f v1(1, 2, 3);
+        Vector3f v2(4, 5, 6);
+        for (size_t i = 0; i < iterations; i++)
+        {
+            Benchmark::doNotOptimize(v1);
+            Benchmark::doNotOptimize(cross(v1, v2));
+        }
+    });
+
+    BENCHMARK("Vector3f/normalize", [](size_t iterations) {
+        Vector3f v(1, 2, 3);
+        for (size_t i = 0; i < iterations; i++)
+        {
+            Benchmark::doNotOptimize(v);
+            Benchmark::doNotOptimize(normalize(v));
+        }
+    });
+
+    BENCHMARK("Vector4f/dot", [](size_t iterations) {
+        Vector4f v1(1, 2, 3, 1);
+        Vector4f v2(4, 5, 6, 0);
+        for (size_t i = 0; i < iterations; i++)
+        {
+            Benchmark::doNotOptimize(v1);
+            Benchmark::doNotOptimize(dot(v1, v2));
+        }
+    });
+
+    BENCHMARK("Math/toRadians", [](size_t iterations) {
+        float degrees = 45;
+        for (size_t i = 0; i < iterations; i++)
+        {
+            Benchmark::doNotOptimize(degrees);
+            Benchmark::doNotOptimize(Math::toRadians(degrees));
+        }
+    });
+
+    BENCHMARK("Vector2f/dot", [](size_t iterations) {
+        Vector2f v1(1, 2);
+        Vector2f v2(3, 4);
+        for (size_t i = 0; i < iterations; i++)
+        {
+            Benchmark::doNotOptimize(v1);
+            Benchmark::doNotOptimize(dot(v1, v2));
+        }
+    });
+
+    BENCHMARK("Vector2f/length", [](size_t iterations) {
+        Vector2f v(1, 2);
+        for (size_t i = 0; i < iterations; i++)
+        {
+            Benchmark::doNotOptimize(v);
+            Benchmark::doNotOptimize(v.length());
+        }
+    });
+
+    BENCHMARK("Vector2f/normalize", [](size_t iterations) {
+        Vector2f v(1, 2);
+        for (size_t i = 0; i < iterations; i++)
+        {
+            Benchmark::doNotOptimize(v);
+            Benchmark::doNotOptimize(normalize(v));
+        }
+    });
+
+    BENCHMARK("Vector3f/sub", [](size_t iterations) {
+        Vector3f v1(1, 2, 3);
+        Vector3f v2(4, 5, 6);
+        for (size_t i = 0; i < iterations; i++)
+        {
+            Benchmark::doNotOptimize(v1);
+            Benchmark::doNotOptimize(v1 - v2);
+        }
+    });
+
+    BENCHMARK("Vector3f/mul", [](size_t iterations) {
+        Vector3f v1(1, 2, 3);
+        Vector3f v2(4, 5, 6);
+        for (size_t i = 0; i < iterations; i++)
+        {
+            Benchmark::doNotOptimize(v1);
+            Benchmark::doNotOptimize(v1 * v2);
+        }
+    });
+
+    BENCHMARK("Vector3f/div", [](size_t iterations) {
+        Vector3f v1(1, 2, 3);
+        Vector3f v2(4, 5, 6);
+        for (size_t i = 0; i < iterations; i++)
+        {
+            Benchmark::doNotOptimize(v1);
+            Benchmark::doNotOptimize(v1 / v2);
+        }
+    });
+
+    BENCHMARK("Vector3f/divScalar", [](size_t iterations) {
+        Vector3f v(1, 2, 3);
+        for (size_t i = 0; i < iterations; i++)
+        {
+            Benchmark::doNotOptimize(v);
+            Benchmark::doNotOptimize(v / 3.0f);
+        }
+    });
+
+    BENCHMARK("Vector3f/length", [](size_t iterations) {
+        Vector3f v(1, 2, 3);
+        for (size_t i = 0; i < iterations; i++)
+        {
+            Benchmark::doNotOptimize(v);
+            Benchmark::doNotOptimize(v.length());
+        }
+    });
+
+    BENCHMARK("Vector3f/min", [](size_t iterations) {
+        Vector3f v(1, 2, 3);
+        for (size_t i = 0; i < iterations; i++)
+        {
+            Benchmark::doNotOptimize(v);
+            Benchmark::doNotOptimize(min(v));
+        }
+    });
+
+    BENCHMARK("Vector4f/add", [](size_t iterations) {
+        Vector4f v1(1, 2, 3, 1);
+        Vector4f v2(4, 5, 6, 0);
+        for (size_t i = 0; i < iterations; i++)
+        {
+            Benchmark::doNotOptimize(v1);
+            Benchmark::doNotOptimize(v1 + v2);
+        }
+    });
+
+    BENCHMARK("Vector4f/cross", [](size_t iterations) {
+        Vector4f v1(1, 2, 3, 1);
+        Vector4f v2(4, 5, 6, 0);
+        for (size_t i = 0; i < iterations; i++)
+        {
+            Benchmark::doNotOptimize(v1);
+            Benchmark::doNotOptimize(cross(v1, v2));
+        }
+    });
+
+    BENCHMARK("Vector4f/normalize", [](size_t iterations) {
+        Vector4f v(1, 2, 3, 1);
+        for (size_t i = 0; i < iterations; i++)
+        {
+            Benchmark::doNotOptimize(v);
+            Benchmark::doNotOptimize(normalize(v));
+        }
+    });
+
+    BENCHMARK("Vector4f/mix", [](size_t iterations) {
+        Vector4f v1(1, 2, 3, 1);
+        Vector4f v2(4, 5, 6, 0);
+        for (size_t i = 0; i < iterations; i++)
+        {
+            Benchmark::doNotOptimize(v1);
+            Benchmark::doNotOptimize(mix(v1, v2, 0.25f));
+        }
+    });
+}
@@ -3,4 +3,7 @@ include(CMakeFindDependencyMacro)
 # Add glfw as a dependency
 find_dependency(glfw3)
 
+# Add threads as a dependency
+find_dependency(Threads)
+
 include(${CMAKE_CURRENT_LIST_DIR}/GDTTargets.cmake)
@@ -0,0 +1,211 @@
+#include "Affine3x4.h"
+
+#include "Matrix3f.h"
+#include "Matrix4f.h"
+#include "Vector3f.h"
+#include "Simd.h"
+
+#include <iomanip>
+#include <sstream>
+
+#ifdef GDT_NAMESPACE
+namespace GDT
+{
+#endif
+    const Affine3x4 Affine3x4::IDENTITY = Affine3x4();
+
+    /* Core */
+    Affine3x4::Affine3x4() {
+        setIdentity();
+    }
+
+    Affine3x4::Affine3x4(const Matrix4f& m) {
+        a[0] = m[0]; a[1] = m[4]; a[2] = m[8];  a[3] = m[12];
+        a[4] = m[1]; a[5] = m[5]; a[6] = m[9];  a[7] = m[13];
+        a[8] = m[2]; a[9] = m[6]; a[10] = m[10]; a[11] = m[14];
+    }
+
+    Affine3x4::Affine3x4(const Matrix3f& linear, const Vector3f& translation) {
+        a[0] = linear[0]; a[1] = linear[3]; a[2] = linear[6];  a[3] = translation.x;
+        a[4] = linear[1]; a[5] = linear[4]; a[6] = linear[7];  a[7] = translation.y;
+        a[8] = linear[2]; a[9] = linear[5]; a[10] = linear[8]; a[11] = translation.z;
+    }
+
+    void Affine3x4::setIdentity() {
+        a[0] = 1; a[1] = 0; a[2] = 0;  a[3] = 0;
+        a[4] = 0; a[5] = 1; a[6] = 0;  a[7] = 0;
+        a[8] = 0; a[9] = 0; a[10] = 1; a[11] = 0;
+    }
+
+    void Affine3x4::translate(const Vector3f& v) {
+        a[3] += a[0] * v.x + a[1] * v.y + a[2] * v.z;
+        a[7] += a[4] * v.x + a[5] * v.y + a[6] * v.z;
+        a[11] += a[8] * v.x + a[9] * v.y + a[10] * v.z;
+    }
+
+    void Affine3x4::scale(const Vector3f& scale) {
+        a[0] *= scale.x; a[1] *= scale.y; a[2] *= scale.z;
+        a[4] *= scale.x; a[5] *= scale.y; a[6] *= scale.z;
+        a[8] *= scale.x; a[9] *= scale.y; a[10] *= scale.z;
+    }
+
+    Matrix3f Affine3x4::getLinear() const {
+        Matrix3f m;
+        m[0] = a[0]; m[3] = a[1]; m[6] = a[2];
+        m[1] = a[4]; m[4] = a[5]; m[7] = a[6];
+        m[2] = a[8]; m[5] = a[9]; m[8] = a[10];
+        return m;
+    }
+
+    Vector3f Affine3x4::getTranslation() const {
+        return Vector3f(a[3], a[7], a[11]);
+    }
+
+    void Affine3x4::setTranslation(const Vector3f& translation) {
+        a[3] = translation.x;
+        a[7] = translation.y;
+        a[11] = translation.z;
+    }
+
+    Matrix4f Affine3x4::toMatrix4f() const {
+        Matrix4f m;
+        m[0] = a[0]; m[4] = a[1]; m[8] = a[2];   m[12] = a[3];
+        m[1] = a[4]; m[5] = a[5]; m[9] = a[6];   m[13] = a[7];
+        m[2] = a[8]; m[6] = a[9]; m[10] = a[10]; m[14] = a[11];
+        return m;
+    }
+
+    Vector3f Affine3x4::transformPoint(const Vector3f& p) const {
+        return Vector3f(
+            a[0] * p.x + a[1] * p.y + a[2] * p.z + a[3],
+            a[4] * p.x + a[5] * p.y + a[6] * p.z + a[7],
+            a[8] * p.x + a[9] * p.y + a[10] * p.z + a[11]);
+    }
+
+    Vector3f Affine3x4::transformDirection(const Vector3f& d) const {
+        return Vector3f(
+            a[0] * d.x + a[1] * d.y + a[2] * d.z,
+            a[4] * d.x + a[5] * d.y + a[6] * d.z,
+            a[8] * d.x + a[9] * d.y + a[10] * d.z);
+    }
+
+    Vector3f Affine3x4::transformNormal(const Vector3f& n) const {
+        // The inverse transpose is the cofactor matrix over the determinant,
+        // whose rows are the cross products of the rows
+        Vector3f r0(a[0], a[1], a[2]);
+        Vector3f r1(a[4], a[5], a[6]);
+        Vector3f r2(a[8], a[9], a[10]);
+
+        Vector3f c0 = cross(r1, r2);
+        Vector3f c1 = cross(r2, r0);
+        Vector3f c2 = cross(r0, r1);
+
+        float invDet = 1 / dot(r0, c0);
+        return Vector3f(dot(c0, n), dot(c1, n), dot(c2, n)) * invDet;
+    }
+
+    void Affine3x4::transformPoints(const Vector3f* in, Vector3f* out, size_t count) const {
+        for (size_t i = 0; i < count; i++)
+            out[i] = transformPoint(in[i]);
+    }
+
+    void Affine3x4::transformDirections(const Vector3f* in, Vector3f* out, size_t count) const {
+        for (size_t i = 0; i < count; i++)
+            out[i] = transformDirection(in[i]);
+    }
+
+    const float* Affine3x4::toArray() const {
+        return a;
+    }
+
+    float* Affine3x4::toArray() {
+        return a;
+    }
+
+    std::string Affine3x4::str() const {
+        std::stringstream ss;
+        ss << "[" << a[0] << ", " << a[1] << ", " << a[2] << ", " << a[3] << "]\n";
+        ss << "[" << a[4] << ", " << a[5] << ", " << a[6] << ", " << a[7] << "]\n";
+        ss << "[" << a[8] << ", " << a[9] << ", " << a[10] << ", " << a[11] << "]\n";
+
+        return ss.str();
+    }
+
+
+    /* Operator overloads */
+    float Affine3x4::operator[](int i) const {
+        return a[i];
+    }
+
+    float& Affine3x4::operator[](int i) {
+        return a[i];
+    }
+
+    bool Affine3x4::operator==(const Affine3x4& m) const {
+        for (int i = 0; i < 12; i++) {
+            if (a[i] != m.a[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool Affine3x4::operator!=(const Affine3x4& m) const {
+        return !(*this == m);
+    }
+
+    // Every row of the result is a combination of the rows of m, plus this
+    // translation in the last column
+    Affine3x4 Affine3x4::operator*(const Affine3x4& m) const {
+        Affine3x4 dest;
+        Simd::Float4 b0 = Simd::load(&m.a[0]);
+        Simd::Float4 b1 = Simd::load(&m.a[4]);
+        Simd::Float4 b2 = Simd::load(&m.a[8]);
+
+        for (int i = 0; i < 12; i += 4) {
+            float t[4] = { 0, 0, 0, a[i + 3] };
+            Simd::Float4 r = Simd::mul(Simd::set1(a[i]), b0);
+            r = Simd::add(r, Simd::mul(Simd::set1(a[i + 1]), b1));
+            r = Simd::add(r, Simd::mul(Simd::set1(a[i + 2]), b2));
+            Simd::store(&dest.a[i], Simd::add(r, Simd::load(t)));
+        }
+        return dest;
+    }
+
+    Affine3x4 inverse(const Affine3x4& m) {
+        // The inverse linear part has the cross products of the columns as its rows
+        Vector3f c0(m[0], m[4], m[8]);
+        Vector3f c1(m[1], m[5], m[9]);
+        Vector3f c2(m[2], m[6], m[10]);
+
+        Vector3f r0 = cross(c1, c2);
+        Vector3f r1 = cross(c2, c0);
+        Vector3f r2 = cross(c0, c1);
+
+        float invDet = 1 / dot(c0, r0);
+        r0 *= invDet;
+        r1 *= invDet;
+        r2 *= invDet;
+
+        Vector3f t = m.getTranslation();
+
+        Affine3x4 d;
+        d[0] = r0.x; d[1] = r0.y; d[2] = r0.z;  d[3] = -dot(r0, t);
+        d[4] = r1.x; d[5] = r1.y; d[6] = r1.z;  d[7] = -dot(r1, t);
+        d[8] = r2.x; d[9] = r2.y; d[10] = r2.z; d[11] = -dot(r2, t);
+        return d;
+    }
+
+#define __ << std::right << std::setw(5) <<
+    std::ostream& operator<<(std::ostream& os, const Affine3x4& m)
+    {
+        os << std::fixed << std::setprecision(2);
+        os << "[" __ m[0] << ", " __ m[1] << ", " __ m[2] << ", " __ m[3] << "]\n";
+        os << "[" __ m[4] << ", " __ m[5] << ", " __ m[6] << ", " __ m[7] << "]\n";
+        os << "[" __ m[8] << ", " __ m[9] << ", " __ m[10] << ", " __ m[11] << "]\n";
+
+        return os;
+    }
+#ifdef GDT_NAMESPACE
+}
+#endif
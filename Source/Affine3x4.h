@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#ifdef GDT_NAMESPACE
+namespace GDT
+{
+#endif
+    class Vector3f;
+    class Matrix3f;
+    class Matrix4f;
+
+    /**
+     * Affine transform stored as the top three rows of a 4x4 matrix, in
+     * row-major order. At 48 bytes it is the compact form for instance
+     * buffers: every row is one vec4 attribute, and a uniform array of them
+     * maps to mat4x3 with ShaderProgram::uniformMatrix4x3fv.
+     */
+    class Affine3x4 {
+    public:
+        static const Affine3x4 IDENTITY;
+
+        /* Core */
+        Affine3x4();
+        Affine3x4(const Matrix4f& m);
+        Affine3x4(const Matrix3f& linear, const Vector3f& translation);
+
+        void setIdentity();
+        void translate(const Vector3f& v);
+        void scale(const Vector3f& scale);
+
+        Matrix3f getLinear() const;
+        Vector3f getTranslation() const;
+        void setTranslation(const Vector3f& translation);
+        Matrix4f toMatrix4f() const;
+
+        Vector3f transformPoint(const Vector3f& p) const;
+        Vector3f transformDirection(const Vector3f& d) const;
+
+        /* Transforms by the inverse transpose of the linear part, the result is not normalized */
+        Vector3f transformNormal(const Vector3f& n) const;
+
+        /* Batch transforms, output may alias the input */
+        void transformPoints(const Vector3f* in, Vector3f* out, size_t count) const;
+        void transformDirections(const Vector3f* in, Vector3f* out, size_t count) const;
+
+        const float* toArray() const;
+        float* toArray();
+        std::string str() const;
+
+        /* Operator overloads */
+        float operator[](int i) const;
+        float& operator[](int i);
+        bool operator==(const Affine3x4& m) const;
+        bool operator!=(const Affine3x4& m) const;
+        Affine3x4 operator*(const Affine3x4& m) const;
+    private:
+        float a[12];
+    };
+
+
+    /* Utility functions */
+    Affine3x4 inverse(const Affine3x4& m);
+
+    std::ostream& operator<<(std::ostream& os, const Affine3x4& m);
+#ifdef GDT_NAMESPACE
+}
+#endif
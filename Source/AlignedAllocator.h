@@ -0,0 +1,63 @@
+#pragma once
+
+#include "Simd.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+#ifdef GDT_NAMESPACE
+namespace GDT
+{
+#endif
+    /**
+     * Standard allocator returning memory aligned to the given number of
+     * bytes, for containers whose elements are loaded into SIMD registers.
+     */
+    template<typename T, size_t Alignment = GDT_SIMD_ALIGNMENT>
+    class AlignedAllocator
+    {
+    public:
+        typedef T value_type;
+
+        template<typename U>
+        struct rebind { typedef AlignedAllocator<U, Alignment> other; };
+
+        AlignedAllocator() {}
+
+        template<typename U>
+        AlignedAllocator(const AlignedAllocator<U, Alignment>&) {}
+
+        T* allocate(size_t n)
+        {
+            // Over-allocate and keep the original pointer just before the aligned block
+            void* base = std::malloc(n * sizeof(T) + Alignment + sizeof(void*));
+            if (base == nullptr)
+                throw std::bad_alloc();
+
+            uintptr_t start = (uintptr_t) base + sizeof(void*);
+            uintptr_t aligned = (start + Alignment - 1) & ~(uintptr_t) (Alignment - 1);
+            ((void**) aligned)[-1] = base;
+
+            return (T*) aligned;
+        }
+
+        void deallocate(T* p, size_t)
+        {
+            if (p != nullptr)
+                std::free(((void**) p)[-1]);
+        }
+
+        template<typename U>
+        bool operator==(const AlignedAllocator<U, Alignment>&) const { return true; }
+
+        template<typename U>
+        bool operator!=(const AlignedAllocator<U, Alignment>&) const { return false; }
+    };
+
+    typedef std::vector<float, AlignedAllocator<float>> AlignedFloatArray;
+#ifdef GDT_NAMESPACE
+}
+#endif
@@ -0,0 +1,229 @@
+#include "BlockWriter.h"
+
+#include "Vector2f.h"
+#include "Vector3f.h"
+#include "Vector4f.h"
+#include "Matrix3f.h"
+#include "Matrix4f.h"
+
+#include <cstring>
+#include <stdexcept>
+
+#ifdef GDT_NAMESPACE
+namespace GDT
+{
+#endif
+    namespace
+    {
+        const size_t COMPONENT_SIZE = 4;
+        const size_t VEC4_ALIGNMENT = 16;
+
+        size_t alignUp(size_t offset, size_t alignment)
+        {
+            return (offset + alignment - 1) / alignment * alignment;
+        }
+    }
+
+    BlockWriter::BlockWriter(BlockLayout layout) :
+        _layout(layout),
+        _offset(0),
+        _destination(nullptr),
+        _capacity(0)
+    {
+
+    }
+
+    BlockWriter::BlockWriter(BlockLayout layout, void* destination, size_t capacity) :
+        _layout(layout),
+        _offset(0),
+        _destination(static_cast<unsigned char*>(destination)),
+        _capacity(capacity)
+    {
+
+    }
+
+    BlockWriter& BlockWriter::write(float f)
+    {
+        memcpy(reserve(COMPONENT_SIZE, sizeof(f)), &f, sizeof(f));
+        return *this;
+    }
+
+    BlockWriter& BlockWriter::write(int i)
+    {
+        memcpy(reserve(COMPONENT_SIZE, sizeof(i)), &i, sizeof(i));
+        return *this;
+    }
+
+    BlockWriter& BlockWriter::write(unsigned int i)
+    {
+        memcpy(reserve(COMPONENT_SIZE, sizeof(i)), &i, sizeof(i));
+        return *this;
+    }
+
+    BlockWriter& BlockWriter::write(const Vector2f& v)
+    {
+        float data[2] = { v.x, v.y };
+        memcpy(reserve(2 * COMPONENT_SIZE, sizeof(data)), data, sizeof(data));
+        return *this;
+    }
+
+    BlockWriter& BlockWriter::write(const Vector3f& v)
+    {
+        float data[3] = { v.x, v.y, v.z };
+        memcpy(reserve(VEC4_ALIGNMENT, sizeof(data)), data, sizeof(data));
+        return *this;
+    }
+
+    BlockWriter& BlockWriter::write(const Vector4f& v)
+    {
+        memcpy(reserve(VEC4_ALIGNMENT, sizeof(v.a)), v.a, sizeof(v.a));
+        return *this;
+    }
+
+    // Matrices are stored as arrays of their columns, a mat3 column takes the space of a vec4
+    BlockWriter& BlockWriter::write(const Matrix3f& m)
+    {
+        writeElements(m.toArray(), 3, 3, VEC4_ALIGNMENT);
+        return *this;
+    }
+
+    BlockWriter& BlockWriter::write(const Matrix4f& m)
+    {
+        memcpy(reserve(VEC4_ALIGNMENT, 16 * COMPONENT_SIZE), m.toArray(), 16 * COMPONENT_SIZE);
+        return *this;
+    }
+
+    BlockWriter& BlockWriter::writeArray(const float* values, size_t count)
+    {
+        writeElements(values, 1, count, COMPONENT_SIZE);
+        return *this;
+    }
+
+    BlockWriter& BlockWriter::writeArray(const int* values, size_t count)
+    {
+        writeElements(values, 1, count, COMPONENT_SIZE);
+        return *this;
+    }
+
+    BlockWriter& BlockWriter::writeArray(const Vector2f* values, size_t count)
+    {
+        writeElements(values, 2, count, 2 * COMPONENT_SIZE);
+        return *this;
+    }
+
+    BlockWriter& BlockWriter::writeArray(const Vector3f* values, size_t count)
+    {
+        writeElements(values, 3, count, VEC4_ALIGNMENT);
+        return *this;
+    }
+
+    BlockWriter& BlockWriter::writeArray(const Vector4f* values, size_t count)
+    {
+        writeElements(values, 4, count, VEC4_ALIGNMENT);
+        return *this;
+    }
+
+    BlockWriter& BlockWriter::writeArray(const Matrix4f* values, size_t count)
+    {
+        for (size_t i = 0; i < count; i++)
+            write(values[i]);
+        return *this;
+    }
+
+    void BlockWriter::align(size_t alignment)
+    {
+        reserve(alignment, 0);
+    }
+
+    void BlockWriter::seek(size_t offset)
+    {
+        ensureBacked(offset);
+        _offset = offset;
+    }
+
+    void BlockWriter::reset()
+    {
+        _offset = 0;
+        _storage.clear();
+    }
+
+    BlockLayout BlockWriter::getLayout() const
+    {
+        return _layout;
+    }
+
+    size_t BlockWriter::getOffset() const
+    {
+        return _offset;
+    }
+
+    size_t BlockWriter::getSize() const
+    {
+        return getPaddedSize(_offset);
+    }
+
+    const unsigned char* BlockWriter::getData() const
+    {
+        return _destination ? _destination : _storage.data();
+    }
+
+    unsigned char* BlockWriter::reserve(size_t alignment, size_t size)
+    {
+        size_t offset = alignUp(_offset, alignment);
+        size_t end = offset + size;
+
+        ensureBacked(end);
+
+        _offset = end;
+        return (_destination ? _destination : _storage.data()) + offset;
+    }
+
+    size_t BlockWriter::getPaddedSize(size_t offset) const
+    {
+        // The size of a std140 block is rounded up to a vec4, like its structs
+        return _layout == BlockLayout::STD140 ? alignUp(offset, VEC4_ALIGNMENT) : offset;
+    }
+
+    void BlockWriter::ensureBacked(size_t offset)
+    {
+        // getData() has to hold getSize() bytes, so the padding of a std140 block is backed as well
+        size_t size = getPaddedSize(offset);
+
+        if (_destination)
+        {
+            if (size > _capacity)
+                throw std::out_of_range("Block write beyond the capacity of the destination");
+        }
+        else if (size > _storage.size())
+        {
+            _storage.resize(size);
+        }
+    }
+
+    void BlockWriter::writeElements(const void* values, size_t components, size_t count, size_t alignment)
+    {
+        // std140 rounds the alignment and stride of every array element up to a vec4
+        if (_layout == BlockLayout::STD140)
+            alignment = VEC4_ALIGNMENT;
+
+        size_t elementSize = components * COMPONENT_SIZE;
+        size_t stride = alignUp(elementSize, alignment);
+        if (count == 0)
+            return;
+
+        // The padding after the last element is part of the array as well
+        unsigned char* data = reserve(alignment, stride * count);
+        const unsigned char* source = static_cast<const unsigned char*>(values);
+
+        if (stride == elementSize)
+        {
+            memcpy(data, source, elementSize * count);
+            return;
+        }
+
+        for (size_t i = 0; i < count; i++)
+            memcpy(data + i * stride, source + i * elementSize, elementSize);
+    }
+#ifdef GDT_NAMESPACE
+}
+#endif
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#ifdef GDT_NAMESPACE
+namespace GDT
+{
+#endif
+    class Vector2f;
+    class Vector3f;
+    class Vector4f;
+    class Matrix3f;
+    class Matrix4f;
+
+    /* Memory layouts of interface blocks, std430 is only allowed for shader storage blocks */
+    enum class BlockLayout
+    {
+        STD140,
+        STD430
+    };
+
+    /**
+     * Writes values at the offsets a GLSL interface block with the given
+     * layout expects them, when written in the order of the block members.
+     * Arrays, matrices and vec3 are padded as the layout rules require, the
+     * contents of padding are left undefined.
+     */
+    class BlockWriter
+    {
+    public:
+        /* Writes into memory owned by the writer, which grows as needed */
+        BlockWriter(BlockLayout layout);
+
+        /**
+         * Writes into existing memory, such as a mapped buffer. Writing or
+         * seeking beyond the capacity throws a std::out_of_range, for std140
+         * this includes the padding that rounds the size up to a vec4.
+         *
+         * @param layout      The layout of the block
+         * @param destination The memory to write to
+         * @param capacity    The size of the memory in bytes
+         */
+        BlockWriter(BlockLayout layout, void* destination, size_t capacity);
+
+        BlockWriter& write(float f);
+        BlockWriter& write(int i);
+        BlockWriter& write(unsigned int i);
+        BlockWriter& write(const Vector2f& v);
+        BlockWriter& write(const Vector3f& v);
+        BlockWriter& write(const Vector4f& v);
+        BlockWriter& write(const Matrix3f& m);
+        BlockWriter& write(const Matrix4f& m);
+
+        BlockWriter& writeArray(const float* values, size_t count);
+        BlockWriter& writeArray(const int* values, size_t count);
+        BlockWriter& writeArray(const Vector2f* values, size_t count);
+        BlockWriter& writeArray(const Vector3f* values, size_t count);
+        BlockWriter& writeArray(const Vector4f* values, size_t count);
+        BlockWriter& writeArray(const Matrix4f* values, size_t count);
+
+        /* Pads to a multiple of alignment, e.g. to start a struct member, which aligns to 16 in std140 */
+        void align(size_t alignment);
+
+        /* Moves to an absolute offset, e.g. one reported by reflection */
+        void seek(size_t offset);
+
+        /* Discards everything written and starts over at offset 0 */
+        void reset();
+
+        BlockLayout getLayout() const;
+
+        /* The offset the next value is written at unless it needs alignment */
+        size_t getOffset() const;
+
+        /* Size of the block written so far, including trailing padding for std140 */
+        size_t getSize() const;
+
+        /* The memory written to, which holds at least getSize() bytes */
+        const unsigned char* getData() const;
+
+    private:
+        /* Aligns the current offset and returns memory for size bytes there */
+        unsigned char* reserve(size_t alignment, size_t size);
+
+        /* Size of a block ending at the given offset, including trailing padding for std140 */
+        size_t getPaddedSize(size_t offset) const;
+
+        /* Makes the memory cover the padded size of a block ending at the given offset */
+        void ensureBacked(size_t offset);
+
+        /* Writes count elements of the given number of 4 byte components with array stride */
+        void writeElements(const void* values, size_t components, size_t count, size_t alignment);
+
+        BlockLayout _layout;
+        size_t _offset;
+
+        std::vector<unsigned char> _storage;
+        unsigned char* _destination;
+        size_t _capacity;
+    };
+#ifdef GDT_NAMESPACE
+}
+#endif
@@ -0,0 +1,91 @@
+#include "Bounds.h"
+
+#include "Maths.h"
+
+#ifdef GDT_NAMESPACE
+namespace GDT
+{
+#endif
+    AABB::AABB() :
+        min(Math::INF),
+        max(-Math::INF)
+    {
+
+    }
+
+    AABB::AABB(const Vector3f& min, const Vector3f& max) :
+        min(min),
+        max(max)
+    {
+
+    }
+
+    void AABB::expand(const Vector3f& point)
+    {
+        min.set(Math::min(min.x, point.x), Math::min(min.y, point.y), Math::min(min.z, point.z));
+        max.set(Math::max(max.x, point.x), Math::max(max.y, point.y), Math::max(max.z, point.z));
+    }
+
+    void AABB::expand(const AABB& box)
+    {
+        if (box.isEmpty())
+            return;
+
+        expand(box.min);
+        expand(box.max);
+    }
+
+    bool AABB::isEmpty() const
+    {
+        return min.x > max.x || min.y > max.y || min.z > max.z;
+    }
+
+    bool AABB::contains(const Vector3f& point) const
+    {
+        return point.x >= min.x && point.y >= min.y && point.z >= min.z &&
+            point.x <= max.x && point.y <= max.y && point.z <= max.z;
+    }
+
+    Vector3f AABB::center() const
+    {
+        return (min + max) * 0.5f;
+    }
+
+    Vector3f AABB::extents() const
+    {
+        return (max - min) * 0.5f;
+    }
+
+    BoundingSphere::BoundingSphere() :
+        center(0),
+        radius(0)
+    {
+
+    }
+
+    BoundingSphere::BoundingSphere(const Vector3f& center, float radius) :
+        center(center),
+        radius(radius)
+    {
+
+    }
+
+    bool BoundingSphere::contains(const Vector3f& point) const
+    {
+        return (point - center).sqrMagnitude() <= radius * radius;
+    }
+
+    std::ostream& operator<<(std::ostream& os, const AABB& box)
+    {
+        os << '[' << box.min << ", " << box.max << ']';
+        return os;
+    }
+
+    std::ostream& operator<<(std::ostream& os, const BoundingSphere& sphere)
+    {
+        os << '[' << sphere.center << ", " << sphere.radius << ']';
+        return os;
+    }
+#ifdef GDT_NAMESPACE
+}
+#endif
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "Vector3f.h"
+
+#include <iostream>
+
+#ifdef GDT_NAMESPACE
+namespace GDT
+{
+#endif
+    /**
+     * Axis-aligned bounding box. A default constructed box is empty, with
+     * min at +infinity and max at -infinity, so expanding it by the first
+     * point yields a box around just that point.
+     */
+    class AABB
+    {
+    public:
+        Vector3f min, max;
+
+        AABB();
+        AABB(const Vector3f& min, const Vector3f& max);
+
+        void expand(const Vector3f& point);
+        void expand(const AABB& box);
+
+        bool isEmpty() const;
+        bool contains(const Vector3f& point) const;
+        Vector3f center() const;
+        /* Half the size of the box along each axis */
+        Vector3f extents() const;
+    };
+
+    class BoundingSphere
+    {
+    public:
+        Vector3f center;
+        float radius;
+
+        BoundingSphere();
+        BoundingSphere(const Vector3f& center, float radius);
+
+        bool contains(const Vector3f& point) const;
+    };
+
+    std::ostream& operator<<(std::ostream& os, const AABB& box);
+    std::ostream& operator<<(std::ostream& os, const BoundingSphere& sphere);
+#ifdef GDT_NAMESPACE
+}
+#endif
@@ -0,0 +1,106 @@
+#include "Buffer.h"
+
+#ifdef GDT_NAMESPACE
+namespace GDT
+{
+#endif
+    Buffer::Buffer(GLenum target)
+        : target(target), handle(0), size(0)
+    {
+
+    }
+
+    void Buffer::create()
+    {
+        glGenBuffers(1, &handle);
+
+        created = true;
+        size = 0;
+    }
+
+    void Buffer::bind() const
+    {
+        glBindBuffer(target, handle);
+    }
+
+    void Buffer::release() const
+    {
+        glBindBuffer(target, 0);
+    }
+
+    void Buffer::destroy()
+    {
+        if (!created) return;
+
+        glDeleteBuffers(1, &handle);
+
+        created = false;
+        handle = 0;
+        size = 0;
+    }
+
+    void Buffer::setData(size_t size, const void* data, GLenum usage)
+    {
+        glBindBuffer(target, handle);
+        glBufferData(target, size, data, usage);
+
+        this->size = size;
+    }
+
+    void Buffer::setSubData(size_t offset, size_t size, const void* data)
+    {
+        glBindBuffer(target, handle);
+        glBufferSubData(target, offset, size, data);
+    }
+
+    void Buffer::bindBase(GLuint index) const
+    {
+        glBindBufferBase(target, index, handle);
+    }
+
+    void Buffer::bindRange(GLuint index, size_t offset, size_t size) const
+    {
+        glBindBufferRange(target, index, handle, offset, size);
+    }
+
+    bool Buffer::isCreated() const
+    {
+        return created;
+    }
+
+    GLuint Buffer::getHandle() const
+    {
+        return handle;
+    }
+
+    size_t Buffer::getSize() const
+    {
+        return size;
+    }
+
+    size_t Buffer::getOffsetAlignment() const
+    {
+        GLint alignment = 0;
+        switch (target)
+        {
+        case GL_UNIFORM_BUFFER: glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment); break;
+        case GL_SHADER_STORAGE_BUFFER: glGetIntegerv(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &alignment); break;
+        default: break;
+        }
+        return alignment > 0 ? (size_t) alignment : 1;
+    }
+
+    UniformBuffer::UniformBuffer()
+        : Buffer(GL_UNIFORM_BUFFER)
+    {
+
+    }
+
+    ShaderStorageBuffer::ShaderStorageBuffer()
+        : Buffer(GL_SHADER_STORAGE_BUFFER)
+    {
+
+    }
+#ifdef GDT_NAMESPACE
+}
+#endif
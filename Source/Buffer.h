@@ -0,0 +1,69 @@
+#pragma once
+
+#include "OpenGL.h"
+
+#include <cstddef>
+
+#ifdef GDT_NAMESPACE
+namespace GDT
+{
+#endif
+    class Buffer
+    {
+    public:
+        Buffer(GLenum target);
+        void create();
+        void bind() const;
+        void release() const;
+        void destroy();
+
+        /**
+         * Allocates the storage of the buffer, discarding its contents
+         *
+         * @param size  The size of the buffer in bytes
+         * @param data  Data to fill the buffer with, or nullptr to leave it undefined
+         * @param usage The usage hint passed to glBufferData
+         */
+        void setData(size_t size, const void* data, GLenum usage = GL_DYNAMIC_DRAW);
+
+        /* Overwrites part of the buffer, which must lie within the storage set with setData */
+        void setSubData(size_t offset, size_t size, const void* data);
+
+        /* Binds the whole buffer to an indexed binding point of the target */
+        void bindBase(GLuint index) const;
+
+        /* Binds a range of the buffer to an indexed binding point, offset must be a multiple of getOffsetAlignment() */
+        void bindRange(GLuint index, size_t offset, size_t size) const;
+
+        bool isCreated() const;
+
+        GLuint getHandle() const;
+        size_t getSize() const;
+
+        /* Alignment the context requires of offsets given to bindRange for this target */
+        size_t getOffsetAlignment() const;
+
+    protected:
+        bool created = false;
+
+        GLenum target;
+        GLuint handle;
+        size_t size;
+    };
+
+    /* Buffer backing a uniform block */
+    class UniformBuffer : public Buffer
+    {
+    public:
+        UniformBuffer();
+    };
+
+    /* Buffer backing a shader storage block */
+    class ShaderStorageBuffer : public Buffer
+    {
+    public:
+        ShaderStorageBuffer();
+    };
+#ifdef GDT_NAMESPACE
+}
+#endif
@@ -0,0 +1,110 @@
+#include "Extensions.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#ifdef GDT_NAMESPACE
+namespace GDT
+{
+#endif
+    namespace Extensions
+    {
+        PFNGLMAXSHADERCOMPILERTHREADSKHRPROC glMaxShaderCompilerThreads = nullptr;
+        PFNGLBUFFERSTORAGEPROC glBufferStorage = nullptr;
+        PFNGLBINDTEXTURESPROC glBindTextures = nullptr;
+
+        namespace
+        {
+            // Sorted for binary search
+            std::vector<std::string> extensionNames;
+
+            bool parallelShaderCompile = false;
+            bool anisotropicFiltering = false;
+
+            bool isVersionAtLeast(GLint major, GLint minor)
+            {
+                GLint contextMajor = 0, contextMinor = 0;
+                glGetIntegerv(GL_MAJOR_VERSION, &contextMajor);
+                glGetIntegerv(GL_MINOR_VERSION, &contextMinor);
+
+                return contextMajor > major || (contextMajor == major && contextMinor >= minor);
+            }
+        }
+
+        void load(GLADloadproc loader)
+        {
+            extensionNames.clear();
+
+            GLint numExtensions = 0;
+            glGetIntegerv(GL_NUM_EXTENSIONS, &numExtensions);
+            for (GLint i = 0; i < numExtensions; i++)
+            {
+                const GLubyte* name = glGetStringi(GL_EXTENSIONS, i);
+                if (name)
+                    extensionNames.push_back((const char*) name);
+            }
+            std::sort(extensionNames.begin(), extensionNames.end());
+
+            // The ARB variant shares the tokens, but names its entry point differently
+            if (isSupported("GL_KHR_parallel_shader_compile"))
+                glMaxShaderCompilerThreads = (PFNGLMAXSHADERCOMPILERTHREADSKHRPROC) loader("glMaxShaderCompilerThreadsKHR");
+            else if (isSupported("GL_ARB_parallel_shader_compile"))
+                glMaxShaderCompilerThreads = (PFNGLMAXSHADERCOMPILERTHREADSKHRPROC) loader("glMaxShaderCompilerThreadsARB");
+            else
+                glMaxShaderCompilerThreads = nullptr;
+
+            parallelShaderCompile = glMaxShaderCompilerThreads != nullptr;
+
+            // Drivers may compile on a single thread until asked for more, 0xFFFFFFFF lets them pick the count
+            if (parallelShaderCompile)
+                glMaxShaderCompilerThreads(0xFFFFFFFF);
+
+            // Core since 4.4 under the same name
+            if (isVersionAtLeast(4, 4) || isSupported("GL_ARB_buffer_storage"))
+                glBufferStorage = (PFNGLBUFFERSTORAGEPROC) loader("glBufferStorage");
+            else
+                glBufferStorage = nullptr;
+
+            if (isVersionAtLeast(4, 4) || isSupported("GL_ARB_multi_bind"))
+                glBindTextures = (PFNGLBINDTEXTURESPROC) loader("glBindTextures");
+            else
+                glBindTextures = nullptr;
+
+            // Only adds tokens, the EXT and ARB variants share them
+            anisotropicFiltering = isVersionAtLeast(4, 6) || isSupported("GL_ARB_texture_filter_anisotropic")
+                || isSupported("GL_EXT_texture_filter_anisotropic");
+        }
+
+        bool isSupported(const char* name)
+        {
+            std::vector<std::string>::const_iterator it = std::lower_bound(extensionNames.begin(), extensionNames.end(), name,
+                [](const std::string& extension, const char* name) { return strcmp(extension.c_str(), name) < 0; });
+
+            return it != extensionNames.end() && strcmp(it->c_str(), name) == 0;
+        }
+
+        bool hasParallelShaderCompile()
+        {
+            return parallelShaderCompile;
+        }
+
+        bool hasBufferStorage()
+        {
+            return glBufferStorage != nullptr;
+        }
+
+        bool hasMultiBind()
+        {
+            return glBindTextures != nullptr;
+        }
+
+        bool hasAnisotropicFiltering()
+        {
+            return anisotropicFiltering;
+        }
+    }
+#ifdef GDT_NAMESPACE
+}
+#endif
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "OpenGL.h"
+
+// Tokens of extensions the generated GL 4.3 loader does not include
+#ifndef GL_MAX_SHADER_COMPILER_THREADS_KHR
+#define GL_MAX_SHADER_COMPILER_THREADS_KHR 0x91B0
+#endif
+#ifndef GL_COMPLETION_STATUS_KHR
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif
+#ifndef GL_MAP_PERSISTENT_BIT
+#define GL_MAP_PERSISTENT_BIT 0x0040
+#endif
+#ifndef GL_MAP_COHERENT_BIT
+#define GL_MAP_COHERENT_BIT 0x0080
+#endif
+#ifndef GL_DYNAMIC_STORAGE_BIT
+#define GL_DYNAMIC_STORAGE_BIT 0x0100
+#endif
+#ifndef GL_CLIENT_STORAGE_BIT
+#define GL_CLIENT_STORAGE_BIT 0x0200
+#endif
+#ifndef GL_TEXTURE_MAX_ANISOTROPY
+#define GL_TEXTURE_MAX_ANISOTROPY 0x84FE
+#endif
+#ifndef GL_MAX_TEXTURE_MAX_ANISOTROPY
+#define GL_MAX_TEXTURE_MAX_ANISOTROPY 0x84FF
+#endif
+
+#ifdef GDT_NAMESPACE
+namespace GDT
+{
+#endif
+    /**
+     * Extensions and entry points beyond the GL 4.3 core the loader was
+     * generated for. Everything reports unsupported until load() is called
+     * with a current context, so code using this falls back to core paths.
+     */
+    namespace Extensions
+    {
+        typedef void (APIENTRYP PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)(GLuint count);
+        typedef void (APIENTRYP PFNGLBUFFERSTORAGEPROC)(GLenum target, GLsizeiptr size, const void* data, GLbitfield flags);
+        typedef void (APIENTRYP PFNGLBINDTEXTURESPROC)(GLuint first, GLsizei count, const GLuint* textures);
+
+        /**
+         * Queries the extensions of the current context and loads their
+         * entry points, the Window does this after creating its context.
+         * With parallel shader compilation the driver is allowed as many
+         * compiler threads as it sees fit.
+         *
+         * @param loader The function used to look up GL entry points
+         */
+        void load(GLADloadproc loader);
+
+        /**
+         * Returns whether the current context supports an extension
+         *
+         * @param name The full name of the extension, e.g. "GL_KHR_parallel_shader_compile"
+         * @return true if the extension was reported when load() was called
+         */
+        bool isSupported(const char* name);
+
+        /* GL_KHR_parallel_shader_compile or GL_ARB_parallel_shader_compile */
+        bool hasParallelShaderCompile();
+
+        /* GL 4.4 or GL_ARB_buffer_storage, for immutable and persistently mapped buffers */
+        bool hasBufferStorage();
+
+        /* GL 4.4 or GL_ARB_multi_bind, for binding several textures in one call */
+        bool hasMultiBind();
+
+        /* GL 4.6 or GL_ARB_texture_filter_anisotropic or GL_EXT_texture_filter_anisotropic */
+        bool hasAnisotropicFiltering();
+
+        /* Null unless hasParallelShaderCompile() */
+        extern PFNGLMAXSHADERCOMPILERTHREADSKHRPROC glMaxShaderCompilerThreads;
+
+        /* Null unless hasBufferStorage() */
+        extern PFNGLBUFFERSTORAGEPROC glBufferStorage;
+
+        /* Null unless hasMultiBind() */
+        extern PFNGLBINDTEXTURESPROC glBindTextures;
+    }
+#ifdef GDT_NAMESPACE
+}
+#endif
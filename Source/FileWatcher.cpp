@@ -0,0 +1,163 @@
+#include "FileWatcher.h"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+#include <sys/stat.h>
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+#ifdef GDT_NAMESPACE
+namespace GDT
+{
+#endif
+    namespace
+    {
+        std::string getDirectory(const std::string& path)
+        {
+            size_t slash = path.find_last_of("/\\");
+            return slash == std::string::npos ? std::string() : path.substr(0, slash + 1);
+        }
+
+#ifndef __linux__
+        time_t getModificationTime(const std::string& path)
+        {
+            struct stat status;
+            if (stat(path.c_str(), &status) != 0)
+                return 0;
+            return status.st_mtime;
+        }
+#endif
+    }
+
+#ifdef __linux__
+    FileWatcher::FileWatcher() :
+        _inotify(inotify_init1(IN_NONBLOCK | IN_CLOEXEC))
+    {
+
+    }
+
+    FileWatcher::~FileWatcher()
+    {
+        if (_inotify >= 0)
+            close(_inotify);
+    }
+
+    void FileWatcher::watch(const std::string& path)
+    {
+        if (!_files.insert(path).second || _inotify < 0)
+            return;
+
+        std::string directory = getDirectory(path);
+        for (const auto& watched : _directories)
+        {
+            if (watched.second == directory)
+                return;
+        }
+
+        // Editors often save by writing a new file and moving it over the old one
+        const uint32_t mask = IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE;
+        int descriptor = inotify_add_watch(_inotify, directory.empty() ? "." : directory.c_str(), mask);
+        if (descriptor >= 0)
+            _directories[descriptor] = directory;
+    }
+
+    void FileWatcher::clear()
+    {
+        for (const auto& watched : _directories)
+            inotify_rm_watch(_inotify, watched.first);
+
+        _directories.clear();
+        _files.clear();
+    }
+
+    std::vector<std::string> FileWatcher::waitForChanges(int timeoutMs)
+    {
+        std::vector<std::string> changed;
+        if (_inotify < 0)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(timeoutMs));
+            return changed;
+        }
+
+        pollfd descriptor = { _inotify, POLLIN, 0 };
+        if (poll(&descriptor, 1, timeoutMs) > 0)
+            readEvents(changed);
+
+        return changed;
+    }
+
+    void FileWatcher::readEvents(std::vector<std::string>& changed)
+    {
+        alignas(inotify_event) char buffer[4096];
+
+        ssize_t length;
+        while ((length = read(_inotify, buffer, sizeof(buffer))) > 0)
+        {
+            for (char* p = buffer; p < buffer + length; p += sizeof(inotify_event) + reinterpret_cast<inotify_event*>(p)->len)
+            {
+                const inotify_event* event = reinterpret_cast<const inotify_event*>(p);
+
+                std::map<int, std::string>::const_iterator directory = _directories.find(event->wd);
+                if (directory == _directories.end() || event->len == 0)
+                    continue;
+
+                std::string path = directory->second + event->name;
+                if (_files.count(path) && std::find(changed.begin(), changed.end(), path) == changed.end())
+                    changed.push_back(path);
+            }
+        }
+    }
+#else
+    FileWatcher::FileWatcher()
+    {
+
+    }
+
+    FileWatcher::~FileWatcher()
+    {
+
+    }
+
+    void FileWatcher::watch(const std::string& path)
+    {
+        if (_files.insert(path).second)
+            _modificationTimes[path] = getModificationTime(path);
+    }
+
+    void FileWatcher::clear()
+    {
+        _files.clear();
+        _modificationTimes.clear();
+    }
+
+    std::vector<std::string> FileWatcher::waitForChanges(int timeoutMs)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(timeoutMs));
+
+        std::vector<std::string> changed;
+        for (auto& file : _modificationTimes)
+        {
+            time_t modificationTime = getModificationTime(file.first);
+            if (modificationTime != file.second)
+            {
+                file.second = modificationTime;
+                changed.push_back(file.first);
+            }
+        }
+        return changed;
+    }
+#endif
+
+    bool FileWatcher::isWatching(const std::string& path) const
+    {
+        return _files.count(path) > 0;
+    }
+#ifdef GDT_NAMESPACE
+}
+#endif
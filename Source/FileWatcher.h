@@ -0,0 +1,61 @@
+#pragma once
+
+#include <ctime>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#ifdef GDT_NAMESPACE
+namespace GDT
+{
+#endif
+    /**
+     * Reports files that were written since they were last checked. On
+     * Linux the directories of the files are watched through inotify, so
+     * files replaced by editors that save through a rename are noticed too.
+     * Elsewhere the modification times of the files are polled.
+     *
+     * A watcher is not thread safe, use it from a single thread.
+     */
+    class FileWatcher
+    {
+    public:
+        FileWatcher();
+        ~FileWatcher();
+
+        FileWatcher(const FileWatcher&) = delete;
+        FileWatcher& operator=(const FileWatcher&) = delete;
+
+        /* Starts watching a file, watching the same file again has no effect */
+        void watch(const std::string& path);
+
+        /* Stops watching all files */
+        void clear();
+
+        bool isWatching(const std::string& path) const;
+
+        /**
+         * Waits until watched files change or the timeout passes
+         *
+         * @param timeoutMs The longest time to wait in milliseconds, 0 to only check
+         * @return the paths of the changed files, as passed to watch()
+         */
+        std::vector<std::string> waitForChanges(int timeoutMs);
+
+    private:
+        std::set<std::string> _files;
+
+#ifdef __linux__
+        void readEvents(std::vector<std::string>& changed);
+
+        int _inotify;
+        // Watch descriptors of directories, with the directory prefix of the files in them
+        std::map<int, std::string> _directories;
+#else
+        std::map<std::string, time_t> _modificationTimes;
+#endif
+    };
+#ifdef GDT_NAMESPACE
+}
+#endif
@@ -0,0 +1,250 @@
+#include "Frustum.h"
+
+#include "Matrix4f.h"
+#include "Bounds.h"
+#include "Vector3fSoA.h"
+#include "Parallel.h"
+#include "Simd.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#ifdef GDT_NAMESPACE
+namespace GDT
+{
+#endif
+    namespace
+    {
+        // Minimum number of mask words, of 32 objects each, culled per thread
+        const size_t CULL_GRAIN_SIZE = 1 << 10;
+
+        inline float planeDistance(const Vector4f& plane, const Vector3f& p)
+        {
+            return plane.x * p.x + plane.y * p.y + plane.z * p.z + plane.w;
+        }
+
+        inline int lowestBit(uint32_t bits)
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return __builtin_ctz(bits);
+#elif defined(_MSC_VER)
+            unsigned long index;
+            _BitScanForward(&index, bits);
+            return (int) index;
+#else
+            int index = 0;
+            while ((bits & 1) == 0)
+            {
+                bits >>= 1;
+                index++;
+            }
+            return index;
+#endif
+        }
+
+        void checkSize(size_t size, size_t expected, const char* name)
+        {
+            if (size < expected)
+            {
+                throw std::invalid_argument(std::string("Frustum culling expected ") + std::to_string(expected) + std::string(" ") + name + std::string(" but got ") + std::to_string(size));
+            }
+        }
+
+        /**
+         * Runs test over groups of four objects and packs the lanes it reports
+         * outside into the inverted bits of the mask. The range is split on
+         * word boundaries, so threads never write to the same mask word.
+         */
+        template<typename Test>
+        void cullBatch(size_t count, size_t paddedSize, std::vector<uint32_t>& mask, Test test)
+        {
+            size_t numWords = (count + 31) / 32;
+            mask.assign(numWords, 0);
+
+            uint32_t* words = mask.data();
+            Parallel::forRange(numWords, CULL_GRAIN_SIZE, [=](size_t begin, size_t end) {
+                for (size_t w = begin; w < end; w++)
+                {
+                    uint32_t bits = 0;
+                    for (size_t j = 0; j < 32; j += 4)
+                    {
+                        size_t i = w * 32 + j;
+                        if (i >= paddedSize)
+                            break;
+
+                        bits |= (uint32_t) (~Simd::moveMask(test(i)) & 0xF) << j;
+                    }
+                    words[w] = bits;
+                }
+            });
+
+            // Clear the bits of the padding past the last object
+            if (count % 32 != 0)
+                mask.back() &= (1u << (count % 32)) - 1;
+        }
+    }
+
+    Frustum::Frustum()
+    {
+        for (int i = 0; i < NUM_PLANES; i++)
+            _planes[i] = Vector4f(0, 0, 0, 1);
+    }
+
+    Frustum::Frustum(const Matrix4f& viewProjection)
+    {
+        set(viewProjection);
+    }
+
+    void Frustum::set(const Matrix4f& m)
+    {
+        // Gribb and Hartmann: every plane is the last row of the matrix plus or minus one of the others
+        for (int i = 0; i < NUM_PLANES; i++)
+        {
+            int row = i / 2;
+            float sign = i % 2 == 0 ? 1.0f : -1.0f;
+
+            Vector4f plane(
+                m[3] + sign * m[row],
+                m[7] + sign * m[4 + row],
+                m[11] + sign * m[8 + row],
+                m[15] + sign * m[12 + row]);
+
+            float invLength = 1.0f / plane.length();
+            _planes[i] = Vector4f(plane.x * invLength, plane.y * invLength, plane.z * invLength, plane.w * invLength);
+        }
+    }
+
+    const Vector4f& Frustum::getPlane(int i) const
+    {
+        return _planes[i];
+    }
+
+    bool Frustum::contains(const Vector3f& point) const
+    {
+        for (int i = 0; i < NUM_PLANES; i++)
+        {
+            if (planeDistance(_planes[i], point) < 0)
+                return false;
+        }
+        return true;
+    }
+
+    bool Frustum::intersects(const AABB& box) const
+    {
+        Vector3f center = box.center();
+        Vector3f extents = box.extents();
+
+        for (int i = 0; i < NUM_PLANES; i++)
+        {
+            const Vector4f& p = _planes[i];
+            float radius = std::fabs(p.x) * extents.x + std::fabs(p.y) * extents.y + std::fabs(p.z) * extents.z;
+            if (planeDistance(p, center) + radius < 0)
+                return false;
+        }
+        return true;
+    }
+
+    bool Frustum::intersects(const BoundingSphere& sphere) const
+    {
+        for (int i = 0; i < NUM_PLANES; i++)
+        {
+            if (planeDistance(_planes[i], sphere.center) + sphere.radius < 0)
+                return false;
+        }
+        return true;
+    }
+
+    void Frustum::cullBoxes(const Vector3fSoA& centers, const Vector3fSoA& extents, std::vector<uint32_t>& mask) const
+    {
+        checkSize(extents.size(), centers.size(), "extents");
+
+        const float* cx = centers.x.data();
+        const float* cy = centers.y.data();
+        const float* cz = centers.z.data();
+        const float* ex = extents.x.data();
+        const float* ey = extents.y.data();
+        const float* ez = extents.z.data();
+        const Vector4f* planes = _planes;
+
+        cullBatch(centers.size(), centers.paddedSize(), mask, [=](size_t i) {
+            Simd::Float4 x = Simd::load(cx + i), y = Simd::load(cy + i), z = Simd::load(cz + i);
+            Simd::Float4 rx = Simd::load(ex + i), ry = Simd::load(ey + i), rz = Simd::load(ez + i);
+            Simd::Float4 zero = Simd::set1(0);
+            Simd::Float4 outside = zero;
+
+            for (int p = 0; p < NUM_PLANES; p++)
+            {
+                const Vector4f& plane = planes[p];
+                Simd::Float4 d = Simd::add(Simd::add(Simd::add(
+                    Simd::mul(x, Simd::set1(plane.x)),
+                    Simd::mul(y, Simd::set1(plane.y))),
+                    Simd::mul(z, Simd::set1(plane.z))),
+                    Simd::set1(plane.w));
+                Simd::Float4 r = Simd::add(Simd::add(
+                    Simd::mul(rx, Simd::set1(std::fabs(plane.x))),
+                    Simd::mul(ry, Simd::set1(std::fabs(plane.y)))),
+                    Simd::mul(rz, Simd::set1(std::fabs(plane.z))));
+                outside = Simd::bitOr(outside, Simd::greaterThan(zero, Simd::add(d, r)));
+            }
+            return outside;
+        });
+    }
+
+    void Frustum::cullSpheres(const Vector3fSoA& centers, const AlignedFloatArray& radii, std::vector<uint32_t>& mask) const
+    {
+        checkSize(radii.size(), centers.paddedSize(), "radii");
+
+        const float* cx = centers.x.data();
+        const float* cy = centers.y.data();
+        const float* cz = centers.z.data();
+        const float* radius = radii.data();
+        const Vector4f* planes = _planes;
+
+        cullBatch(centers.size(), centers.paddedSize(), mask, [=](size_t i) {
+            Simd::Float4 x = Simd::load(cx + i), y = Simd::load(cy + i), z = Simd::load(cz + i);
+            Simd::Float4 r = Simd::load(radius + i);
+            Simd::Float4 zero = Simd::set1(0);
+            Simd::Float4 outside = zero;
+
+            for (int p = 0; p < NUM_PLANES; p++)
+            {
+                const Vector4f& plane = planes[p];
+                Simd::Float4 d = Simd::add(Simd::add(Simd::add(
+                    Simd::mul(x, Simd::set1(plane.x)),
+                    Simd::mul(y, Simd::set1(plane.y))),
+                    Simd::mul(z, Simd::set1(plane.z))),
+                    Simd::set1(plane.w));
+                outside = Simd::bitOr(outside, Simd::greaterThan(zero, Simd::add(d, r)));
+            }
+            return outside;
+        });
+    }
+
+    void visibleIndices(const std::vector<uint32_t>& mask, size_t count, std::vector<uint32_t>& indices)
+    {
+        indices.clear();
+
+        size_t numWords = std::min(mask.size(), (count + 31) / 32);
+        for (size_t w = 0; w < numWords; w++)
+        {
+            uint32_t bits = mask[w];
+            while (bits != 0)
+            {
+                size_t i = w * 32 + lowestBit(bits);
+                if (i >= count)
+                    return;
+
+                indices.push_back((uint32_t) i);
+                bits &= bits - 1;
+            }
+        }
+    }
+#ifdef GDT_NAMESPACE
+}
+#endif
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "Vector4f.h"
+#include "AlignedAllocator.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#ifdef GDT_NAMESPACE
+namespace GDT
+{
+#endif
+    class Matrix4f;
+    class AABB;
+    class BoundingSphere;
+    class Vector3fSoA;
+
+    /**
+     * View frustum as six planes facing inwards, in the order left, right,
+     * bottom, top, near, far. Every plane is stored as a Vector4f holding
+     * the unit normal in xyz and the distance in w, so a point p is inside
+     * the plane when dot(normal, p) + w >= 0.
+     */
+    class Frustum
+    {
+    public:
+        static const int NUM_PLANES = 6;
+
+        Frustum();
+
+        /**
+         * Extracts the planes from an OpenGL style projection matrix, with
+         * clip space depth in [-1, 1]. A projection matrix gives the planes
+         * in view space, a view-projection matrix gives them in world space.
+         */
+        Frustum(const Matrix4f& viewProjection);
+
+        void set(const Matrix4f& viewProjection);
+        const Vector4f& getPlane(int i) const;
+
+        /* Exact test of whether the point lies inside all six planes */
+        bool contains(const Vector3f& point) const;
+
+        /* Conservative tests, boxes and spheres near a corner may pass while being outside */
+        bool intersects(const AABB& box) const;
+        bool intersects(const BoundingSphere& sphere) const;
+
+        /**
+         * Tests a batch of boxes, given by their centers and extents, against
+         * the frustum. Bit i % 32 of mask word i / 32 is set when box i may
+         * be visible. Large batches are split across threads.
+         *
+         * @param centers The centers of the boxes
+         * @param extents Half the size of the boxes along each axis
+         * @param mask    Resized to hold one bit per box
+         */
+        void cullBoxes(const Vector3fSoA& centers, const Vector3fSoA& extents, std::vector<uint32_t>& mask) const;
+
+        /**
+         * Tests a batch of spheres against the frustum, writing the same
+         * visibility mask as cullBoxes.
+         *
+         * @param centers The centers of the spheres
+         * @param radii   The radius of every sphere, padded to centers.paddedSize() like the output of length()
+         * @param mask    Resized to hold one bit per sphere
+         */
+        void cullSpheres(const Vector3fSoA& centers, const AlignedFloatArray& radii, std::vector<uint32_t>& mask) const;
+
+    private:
+        Vector4f _planes[NUM_PLANES];
+    };
+
+    /* Compacts a visibility mask of count bits into the ascending indices of the set bits */
+    void visibleIndices(const std::vector<uint32_t>& mask, size_t count, std::vector<uint32_t>& indices);
+#ifdef GDT_NAMESPACE
+}
+#endif
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#ifdef GDT_NAMESPACE
+namespace GDT
+{
+#endif
+    namespace Hash
+    {
+        const uint64_t FNV_OFFSET_BASIS = 14695981039346656037ull;
+        const uint64_t FNV_PRIME = 1099511628211ull;
+
+        /**
+         * 64 bit FNV-1a hash of a block of memory, pass the result of a
+         * previous call as hash to combine several blocks into one key
+         *
+         * @param data The bytes to hash
+         * @param size The number of bytes
+         * @param hash The hash to continue from
+         * @return the combined hash
+         */
+        inline uint64_t fnv1a(const void* data, size_t size, uint64_t hash = FNV_OFFSET_BASIS)
+        {
+            const unsigned char* bytes = static_cast<const unsigned char*>(data);
+            for (size_t i = 0; i < size; i++)
+            {
+                hash ^= bytes[i];
+                hash *= FNV_PRIME;
+            }
+            return hash;
+        }
+
+        /* Hashes the length along with the characters, so ("ab", "c") and ("a", "bc") differ */
+        inline uint64_t fnv1a(const std::string& s, uint64_t hash = FNV_OFFSET_BASIS)
+        {
+            uint64_t length = s.size();
+            hash = fnv1a(&length, sizeof(length), hash);
+            return fnv1a(s.data(), s.size(), hash);
+        }
+    }
+#ifdef GDT_NAMESPACE
+}
+#endif
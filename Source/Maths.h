@@ -2,21 +2,43 @@
 
 #include <limits>
 
+// Functions that need the relaxed constexpr rules of C++14 (multiple
+// statements, mutating members) are only constexpr from C++14 onwards
+#if (defined(__cpp_constexpr) && __cpp_constexpr >= 201304L) || (defined(_MSVC_LANG) && _MSVC_LANG >= 201402L)
+#define GDT_CONSTEXPR14 constexpr
+#else
+#define GDT_CONSTEXPR14 inline
+#endif
+
 #ifdef GDT_NAMESPACE
 namespace GDT
 {
 #endif
     namespace Math
     {
-        const float PI = 3.14159265359f;
-        const float TWO_PI = 2 * 3.14159265359f;
-        const float INF = std::numeric_limits<float>::infinity();
+        constexpr float PI = 3.14159265359f;
+        constexpr float TWO_PI = 2 * 3.14159265359f;
+        constexpr float INF = std::numeric_limits<float>::infinity();
+
+        constexpr float min(float f1, float f2)
+        {
+            return f1 < f2 ? f1 : f2;
+        }
+
+        constexpr float max(float f1, float f2)
+        {
+            return f1 > f2 ? f1 : f2;
+        }
 
-        float min(float f1, float f2);
-        float max(float f1, float f2);
+        constexpr float toDegrees(const float radians)
+        {
+            return radians * (180 / PI);
+        }
 
-        float toDegrees(const float radians);
-        float toRadians(const float degrees);
+        constexpr float toRadians(const float degrees)
+        {
+            return degrees * (PI / 180);
+        }
     }
 #ifdef GDT_NAMESPACE
 }
@@ -0,0 +1,171 @@
+#include "Matrix3f.h"
+
+#include "Matrix4f.h"
+#include "Vector3f.h"
+
+#include <iomanip>
+#include <sstream>
+
+#ifdef GDT_NAMESPACE
+namespace GDT
+{
+#endif
+    const Matrix3f Matrix3f::IDENTITY = Matrix3f();
+
+    /* Core */
+    Matrix3f::Matrix3f() {
+        setIdentity();
+    }
+
+    Matrix3f::Matrix3f(const Matrix4f& m) {
+        a[0] = m[0]; a[1] = m[1]; a[2] = m[2];
+        a[3] = m[4]; a[4] = m[5]; a[5] = m[6];
+        a[6] = m[8]; a[7] = m[9]; a[8] = m[10];
+    }
+
+    Matrix3f::Matrix3f(Vector3f t, Vector3f b, Vector3f n) {
+        a[0] = t.x; a[1] = b.x; a[2] = n.x;
+        a[3] = t.y; a[4] = b.y; a[5] = n.y;
+        a[6] = t.z; a[7] = b.z; a[8] = n.z;
+    }
+
+    void Matrix3f::setIdentity() {
+        a[0] = 1; a[1] = 0; a[2] = 0;
+        a[3] = 0; a[4] = 1; a[5] = 0;
+        a[6] = 0; a[7] = 0; a[8] = 1;
+    }
+
+    void Matrix3f::scale(const Vector3f& scale) {
+        a[0] *= scale.x;
+        a[1] *= scale.x;
+        a[2] *= scale.x;
+        a[3] *= scale.y;
+        a[4] *= scale.y;
+        a[5] *= scale.y;
+        a[6] *= scale.z;
+        a[7] *= scale.z;
+        a[8] *= scale.z;
+    }
+
+    Matrix4f Matrix3f::toMatrix4f() const {
+        Matrix4f m;
+        m[0] = a[0]; m[1] = a[1]; m[2] = a[2];
+        m[4] = a[3]; m[5] = a[4]; m[6] = a[5];
+        m[8] = a[6]; m[9] = a[7]; m[10] = a[8];
+        return m;
+    }
+
+    const float* Matrix3f::toArray() const {
+        return a;
+    }
+
+    float* Matrix3f::toArray() {
+        return a;
+    }
+
+    std::string Matrix3f::str() const {
+        std::stringstream ss;
+        ss << "[" << a[0] << ", " << a[3] << ", " << a[6] << "]\n";
+        ss << "[" << a[1] << ", " << a[4] << ", " << a[7] << "]\n";
+        ss << "[" << a[2] << ", " << a[5] << ", " << a[8] << "]\n";
+
+        return ss.str();
+    }
+
+
+    /* Operator overloads */
+    float Matrix3f::operator[](int i) const {
+        return a[i];
+    }
+
+    float& Matrix3f::operator[](int i) {
+        return a[i];
+    }
+
+    bool Matrix3f::operator==(const Matrix3f& m) const {
+        for (int i = 0; i < 9; i++) {
+            if (a[i] != m.a[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool Matrix3f::operator!=(const Matrix3f& m) const {
+        return !(*this == m);
+    }
+
+    Matrix3f Matrix3f::operator*(const Matrix3f& m) const {
+        Matrix3f dest;
+        dest.a[0] = a[0] * m.a[0] + a[3] * m.a[1] + a[6] * m.a[2];
+        dest.a[1] = a[1] * m.a[0] + a[4] * m.a[1] + a[7] * m.a[2];
+        dest.a[2] = a[2] * m.a[0] + a[5] * m.a[1] + a[8] * m.a[2];
+
+        dest.a[3] = a[0] * m.a[3] + a[3] * m.a[4] + a[6] * m.a[5];
+        dest.a[4] = a[1] * m.a[3] + a[4] * m.a[4] + a[7] * m.a[5];
+        dest.a[5] = a[2] * m.a[3] + a[5] * m.a[4] + a[8] * m.a[5];
+
+        dest.a[6] = a[0] * m.a[6] + a[3] * m.a[7] + a[6] * m.a[8];
+        dest.a[7] = a[1] * m.a[6] + a[4] * m.a[7] + a[7] * m.a[8];
+        dest.a[8] = a[2] * m.a[6] + a[5] * m.a[7] + a[8] * m.a[8];
+        return dest;
+    }
+
+    Vector3f Matrix3f::operator*(const Vector3f& v) const {
+        Vector3f dest;
+        dest.x = a[0] * v.x + a[3] * v.y + a[6] * v.z;
+        dest.y = a[1] * v.x + a[4] * v.y + a[7] * v.z;
+        dest.z = a[2] * v.x + a[5] * v.y + a[8] * v.z;
+        return dest;
+    }
+
+    Matrix3f transpose(const Matrix3f& m) {
+        Matrix3f d;
+        d[0] = m[0];	d[3] = m[1];	d[6] = m[2];
+        d[1] = m[3];	d[4] = m[4];	d[7] = m[5];
+        d[2] = m[6];	d[5] = m[7];	d[8] = m[8];
+        return d;
+    }
+
+    float determinant(const Matrix3f& m) {
+        return m[0] * (m[4] * m[8] - m[5] * m[7])
+            + m[1] * (m[5] * m[6] - m[3] * m[8])
+            + m[2] * (m[3] * m[7] - m[4] * m[6]);
+    }
+
+    Matrix3f inverse(const Matrix3f& m) {
+        // The rows of the inverse are the cross products of the columns over the determinant
+        Vector3f c0(m[0], m[1], m[2]);
+        Vector3f c1(m[3], m[4], m[5]);
+        Vector3f c2(m[6], m[7], m[8]);
+
+        Vector3f r0 = cross(c1, c2);
+        Vector3f r1 = cross(c2, c0);
+        Vector3f r2 = cross(c0, c1);
+
+        float invDet = 1 / dot(c0, r0);
+
+        Matrix3f d;
+        d[0] = r0.x * invDet; d[3] = r0.y * invDet; d[6] = r0.z * invDet;
+        d[1] = r1.x * invDet; d[4] = r1.y * invDet; d[7] = r1.z * invDet;
+        d[2] = r2.x * invDet; d[5] = r2.y * invDet; d[8] = r2.z * invDet;
+        return d;
+    }
+
+    Matrix3f normalMatrix(const Matrix4f& m) {
+        return transpose(inverse(Matrix3f(m)));
+    }
+
+#define __ << std::right << std::setw(5) <<
+    std::ostream& operator<<(std::ostream& os, const Matrix3f& m)
+    {
+        os << std::fixed << std::setprecision(2);
+        os << "[" __ m[0] << ", " __ m[3] << ", " __ m[6] << "]\n";
+        os << "[" __ m[1] << ", " __ m[4] << ", " __ m[7] << "]\n";
+        os << "[" __ m[2] << ", " __ m[5] << ", " __ m[8] << "]\n";
+
+        return os;
+    }
+#ifdef GDT_NAMESPACE
+}
+#endif
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <string>
+
+#ifdef GDT_NAMESPACE
+namespace GDT
+{
+#endif
+    class Vector3f;
+    class Matrix4f;
+
+    class Matrix3f {
+    public:
+        static const Matrix3f IDENTITY;
+
+        /* Core */
+        Matrix3f();
+        Matrix3f(const Matrix4f& m);
+        Matrix3f(Vector3f t, Vector3f b, Vector3f n);
+
+        void setIdentity();
+        void scale(const Vector3f& scale);
+        Matrix4f toMatrix4f() const;
+
+        const float* toArray() const;
+        float* toArray();
+        std::string str() const;
+
+        /* Operator overloads */
+        float operator[](int i) const;
+        float& operator[](int i);
+        bool operator==(const Matrix3f& m) const;
+        bool operator!=(const Matrix3f& m) const;
+        Matrix3f operator*(const Matrix3f& m) const;
+        Vector3f operator*(const Vector3f& v) const;
+    private:
+        float a[9];
+    };
+
+
+    /* Utility functions */
+    Matrix3f transpose(const Matrix3f& m);
+    float determinant(const Matrix3f& m);
+    Matrix3f inverse(const Matrix3f& m);
+
+    /* Inverse transpose of the upper 3x3 part, which transforms normals */
+    Matrix3f normalMatrix(const Matrix4f& m);
+
+    std::ostream& operator<<(std::ostream& os, const Matrix3f& m);
+#ifdef GDT_NAMESPACE
+}
+#endif
@@ -2,7 +2,9 @@
 
 #include "Vector3f.h"
 #include "Vector4f.h"
+#include "Quaternionf.h"
 #include "Maths.h"
+#include "Parallel.h"
 
 #include <cmath>
 #include <iomanip>
@@ -12,48 +14,124 @@
 namespace GDT
 {
 #endif
-    const Matrix4f Matrix4f::IDENTITY = Matrix4f();
-    const Matrix4f Matrix4f::BIAS = Matrix4f(0.5f, 0.0f, 0.0f, 0.0f,
-        0.0f, 0.5f, 0.0f, 0.0f,
-        0.0f, 0.0f, 0.5f, 0.0f,
-        0.5f, 0.5f, 0.5f, 1.0f);
-
-    /* Core */
-    Matrix4f::Matrix4f() {
-        setIdentity();
-    }
-
-    Matrix4f::Matrix4f(Vector3f t, Vector3f b, Vector3f n) :
-        Matrix4f(t.x, b.x, n.x, 0,
-                 t.y, b.y, n.y, 0,
-                 t.z, b.z, n.z, 0,
-                 0, 0, 0, 1)
+    namespace
     {
+        // Minimum number of vectors transformed per thread in batch transforms
+        const size_t BATCH_GRAIN_SIZE = 1 << 16;
+
+        template<bool Point>
+        void transformRange(const float* a, const unsigned char* in, size_t stride, Vector3f* out, size_t begin, size_t end)
+        {
+#if defined(GDT_SIMD_FLOAT4)
+            Simd::Float4 c0 = Simd::load(&a[0]);
+            Simd::Float4 c1 = Simd::load(&a[4]);
+            Simd::Float4 c2 = Simd::load(&a[8]);
+            Simd::Float4 c3 = Simd::load(&a[12]);
+            float r[4];
+
+            for (size_t i = begin; i < end; i++) {
+                const float* v = (const float*) (in + i * stride);
+                Simd::Float4 d = Simd::mul(c0, Simd::set1(v[0]));
+                d = Simd::add(d, Simd::mul(c1, Simd::set1(v[1])));
+                d = Simd::add(d, Simd::mul(c2, Simd::set1(v[2])));
+                if (Point) {
+                    d = Simd::add(d, c3);
+                    Simd::store(r, d);
+                    float invw = 1.0f / r[3];
+                    out[i].set(r[0] * invw, r[1] * invw, r[2] * invw);
+                }
+                else {
+                    Simd::store(r, d);
+                    out[i].set(r[0], r[1], r[2]);
+                }
+            }
+#else
+            for (size_t i = begin; i < end; i++) {
+                const float* v = (const float*) (in + i * stride);
+                float x = a[0] * v[0] + a[4] * v[1] + a[8] * v[2];
+                float y = a[1] * v[0] + a[5] * v[1] + a[9] * v[2];
+                float z = a[2] * v[0] + a[6] * v[1] + a[10] * v[2];
+                if (Point) {
+                    float invw = 1.0f / (a[3] * v[0] + a[7] * v[1] + a[11] * v[2] + a[15]);
+                    out[i].set((x + a[12]) * invw, (y + a[13]) * invw, (z + a[14]) * invw);
+                }
+                else {
+                    out[i].set(x, y, z);
+                }
+            }
+#endif
+        }
 
-    }
+        void transformRange(const float* a, const Vector4f* in, Vector4f* out, size_t begin, size_t end)
+        {
+#if defined(GDT_SIMD_FLOAT4)
+            Simd::Float4 c0 = Simd::load(&a[0]);
+            Simd::Float4 c1 = Simd::load(&a[4]);
+            Simd::Float4 c2 = Simd::load(&a[8]);
+            Simd::Float4 c3 = Simd::load(&a[12]);
+
+            for (size_t i = begin; i < end; i++) {
+                const Vector4f& v = in[i];
+                Simd::Float4 d = Simd::mul(c0, Simd::set1(v.x));
+                d = Simd::add(d, Simd::mul(c1, Simd::set1(v.y)));
+                d = Simd::add(d, Simd::mul(c2, Simd::set1(v.z)));
+                d = Simd::add(d, Simd::mul(c3, Simd::set1(v.w)));
+                Simd::store(out[i].a, d);
+            }
+#else
+            for (size_t i = begin; i < end; i++) {
+                Vector4f v = in[i];
+                out[i].x = a[0] * v.x + a[4] * v.y + a[8] * v.z + a[12] * v.w;
+                out[i].y = a[1] * v.x + a[5] * v.y + a[9] * v.z + a[13] * v.w;
+                out[i].z = a[2] * v.x + a[6] * v.y + a[10] * v.z + a[14] * v.w;
+                out[i].w = a[3] * v.x + a[7] * v.y + a[11] * v.z + a[15] * v.w;
+            }
+#endif
+        }
 
-    Matrix4f::Matrix4f(float m0, float m1, float m2, float m3,
-        float m4, float m5, float m6, float m7,
-        float m8, float m9, float m10, float m11,
-        float m12, float m13, float m14, float m15) {
-        a[0] = m0;   a[1] = m1;   a[2] = m2;   a[3] = m3;
-        a[4] = m4;   a[5] = m5;   a[6] = m6;   a[7] = m7;
-        a[8] = m8;   a[9] = m9;   a[10] = m10; a[11] = m11;
-        a[12] = m12; a[13] = m13; a[14] = m14; a[15] = m15;
-    }
+        // Contiguous input has a fixed stride, which lets the compiler vectorize across vectors
+        template<bool Point>
+        void transformContiguous(const float* a, const Vector3f* in, Vector3f* out, size_t begin, size_t end)
+        {
+            // Copy the matrix so the compiler can keep it in registers, out could alias it otherwise
+            float m[16];
+            for (int k = 0; k < 16; k++)
+                m[k] = a[k];
+
+            for (size_t i = begin; i < end; i++) {
+                Vector3f v = in[i];
+                float x = m[0] * v.x + m[4] * v.y + m[8] * v.z;
+                float y = m[1] * v.x + m[5] * v.y + m[9] * v.z;
+                float z = m[2] * v.x + m[6] * v.y + m[10] * v.z;
+                if (Point) {
+                    float invw = 1.0f / (m[3] * v.x + m[7] * v.y + m[11] * v.z + m[15]);
+                    out[i].set((x + m[12]) * invw, (y + m[13]) * invw, (z + m[14]) * invw);
+                }
+                else {
+                    out[i].set(x, y, z);
+                }
+            }
+        }
 
-    void Matrix4f::setIdentity() {
-        for (int i = 0; i < 16; i++) {
-            a[i] = i % 5 == 0 ? 1.0f : 0.0f;
+        template<bool Point>
+        void transformBatch(const float* a, const void* in, size_t stride, Vector3f* out, size_t count)
+        {
+            const unsigned char* bytes = (const unsigned char*) in;
+            Parallel::forRange(count, BATCH_GRAIN_SIZE, [=](size_t begin, size_t end) {
+                if (stride == sizeof(Vector3f))
+                    transformContiguous<Point>(a, (const Vector3f*) bytes, out, begin, end);
+                else
+                    transformRange<Point>(a, bytes, stride, out, begin, end);
+            });
         }
     }
 
-    void Matrix4f::translate(const Vector3f& v) {
-        a[12] += a[0] * v.x + a[4] * v.y + a[8] * v.z;
-        a[13] += a[1] * v.x + a[5] * v.y + a[9] * v.z;
-        a[14] += a[2] * v.x + a[6] * v.y + a[10] * v.z;
-        a[15] += a[3] * v.x + a[7] * v.y + a[11] * v.z;
-    }
+    // Constant-initialized through the constexpr constructors, so they are usable during static initialization
+    const Matrix4f Matrix4f::IDENTITY = Matrix4f();
+    const Matrix4f Matrix4f::BIAS = Matrix4f(0.5f, 0.0f, 0.0f, 0.0f,
+        0.0f, 0.5f, 0.0f, 0.0f,
+        0.0f, 0.0f, 0.5f, 0.0f,
+        0.5f, 0.5f, 0.5f, 1.0f);
 
     void Matrix4f::rotate(float angle, float x, float y, float z) {
         float c = cos(Math::toRadians(angle));
@@ -86,51 +164,43 @@ namespace GDT
         rotate(euler.z, 0, 0, 1);
     }
 
-    void Matrix4f::scale(float scale) {
-        a[0] *= scale;
-        a[1] *= scale;
-        a[2] *= scale;
-        a[3] *= scale;
-        a[4] *= scale;
-        a[5] *= scale;
-        a[6] *= scale;
-        a[7] *= scale;
-        a[8] *= scale;
-        a[9] *= scale;
-        a[10] *= scale;
-        a[11] *= scale;
+    void Matrix4f::rotate(const Quaternionf& q) {
+        *this = *this * q.toMatrix();
+    }
+
+    void Matrix4f::transformPoints(const Vector3f* in, Vector3f* out, size_t count) const {
+        transformBatch<true>(a, in, sizeof(Vector3f), out, count);
+    }
+
+    void Matrix4f::transformPoints(const void* in, size_t stride, Vector3f* out, size_t count) const {
+        transformBatch<true>(a, in, stride, out, count);
+    }
+
+    void Matrix4f::transformPoints(Vector3f* points, size_t count) const {
+        transformBatch<true>(a, points, sizeof(Vector3f), points, count);
     }
 
-    void Matrix4f::scale(const Vector3f& scale) {
-        a[0] *= scale.x;
-        a[1] *= scale.x;
-        a[2] *= scale.x;
-        a[3] *= scale.x;
-        a[4] *= scale.y;
-        a[5] *= scale.y;
-        a[6] *= scale.y;
-        a[7] *= scale.y;
-        a[8] *= scale.z;
-        a[9] *= scale.z;
-        a[10] *= scale.z;
-        a[11] *= scale.z;
+    void Matrix4f::transformDirections(const Vector3f* in, Vector3f* out, size_t count) const {
+        transformBatch<false>(a, in, sizeof(Vector3f), out, count);
     }
 
-    Vector3f Matrix4f::transform(const Vector3f& v, int w) const {
-        Vector3f dest;
-        dest.x = a[0] * v.x + a[4] * v.y + a[8] * v.z + a[12] * w;
-        dest.y = a[1] * v.x + a[5] * v.y + a[9] * v.z + a[13] * w;
-        dest.z = a[2] * v.x + a[6] * v.y + a[10] * v.z + a[14] * w;
-        float dest_w = a[3] * v.x + a[7] * v.y + a[11] * v.z + a[15] * w;
-        return w == 0 ? dest : dest / dest_w;
+    void Matrix4f::transformDirections(const void* in, size_t stride, Vector3f* out, size_t count) const {
+        transformBatch<false>(a, in, stride, out, count);
     }
 
-    const float* Matrix4f::toArray() const {
-        return a;
+    void Matrix4f::transformDirections(Vector3f* directions, size_t count) const {
+        transformBatch<false>(a, directions, sizeof(Vector3f), directions, count);
     }
 
-    float* Matrix4f::toArray() {
-        return a;
+    void Matrix4f::transform(const Vector4f* in, Vector4f* out, size_t count) const {
+        const float* m = a;
+        Parallel::forRange(count, BATCH_GRAIN_SIZE, [=](size_t begin, size_t end) {
+            transformRange(m, in, out, begin, end);
+        });
+    }
+
+    void Matrix4f::transform(Vector4f* v, size_t count) const {
+        transform(v, v, count);
     }
 
     std::string Matrix4f::str() const {
@@ -144,141 +214,199 @@ namespace GDT
     }
 
 
-    /* Operator overloads */
-    float Matrix4f::operator[](int i) const {
-        return a[i];
+    Matrix4f transpose(const Matrix4f& m) {
+        Matrix4f d;
+        d[0] = m[0];	d[4] = m[1];	d[8] = m[2];	d[12] = m[3];
+        d[1] = m[4];	d[5] = m[5];	d[9] = m[6];	d[13] = m[7];
+        d[2] = m[8];	d[6] = m[9];	d[10] = m[10];	d[14] = m[11];
+        d[3] = m[12];	d[7] = m[13];	d[11] = m[14];	d[15] = m[15];
+        return d;
     }
 
-    float& Matrix4f::operator[](int i) {
-        return a[i];
-    }
+    namespace
+    {
+        // Determinants of the 2x2 sub-matrices in the upper (s) and lower (c)
+        // half of the matrix, shared by determinant and inverse. The formulas
+        // are written for a row-major matrix, which for our column-major
+        // storage yields the transposed inverse of the transpose, i.e. the
+        // inverse itself.
+        struct SubDeterminants
+        {
+            float s0, s1, s2, s3, s4, s5;
+            float c0, c1, c2, c3, c4, c5;
+
+            SubDeterminants(const float* m)
+            {
+                s0 = m[0] * m[5] - m[4] * m[1];
+                s1 = m[0] * m[6] - m[4] * m[2];
+                s2 = m[0] * m[7] - m[4] * m[3];
+                s3 = m[1] * m[6] - m[5] * m[2];
+                s4 = m[1] * m[7] - m[5] * m[3];
+                s5 = m[2] * m[7] - m[6] * m[3];
+
+                c5 = m[10] * m[15] - m[14] * m[11];
+                c4 = m[9] * m[15] - m[13] * m[11];
+                c3 = m[9] * m[14] - m[13] * m[10];
+                c2 = m[8] * m[15] - m[12] * m[11];
+                c1 = m[8] * m[14] - m[12] * m[10];
+                c0 = m[8] * m[13] - m[12] * m[9];
+            }
 
-    bool Matrix4f::operator==(const Matrix4f& m) const {
-        for (int i = 0; i < 16; i++) {
-            if (a[i] != m.a[i]) {
-                return false;
+            float determinant() const
+            {
+                return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
             }
+        };
+
+#if defined(GDT_SIMD_SSE)
+#define GDT_SHUFFLE(v1, v2, x, y, z, w) _mm_shuffle_ps(v1, v2, _MM_SHUFFLE(w, z, y, x))
+#define GDT_SWIZZLE(v, x, y, z, w) GDT_SHUFFLE(v, v, x, y, z, w)
+
+        // Products of 2x2 matrices stored as (m00, m01, m10, m11), # denotes the adjugate
+        inline __m128 mat2Mul(__m128 v1, __m128 v2) // v1 * v2
+        {
+            return _mm_add_ps(_mm_mul_ps(v1, GDT_SWIZZLE(v2, 0, 3, 0, 3)),
+                              _mm_mul_ps(GDT_SWIZZLE(v1, 1, 0, 3, 2), GDT_SWIZZLE(v2, 2, 1, 2, 1)));
         }
-        return true;
-    }
 
-    bool Matrix4f::operator!=(const Matrix4f& m) const {
-        for (int i = 0; i < 16; i++) {
-            if (a[i] != m.a[i]) {
-                return true;
-            }
+        inline __m128 mat2AdjMul(__m128 v1, __m128 v2) // v1# * v2
+        {
+            return _mm_sub_ps(_mm_mul_ps(GDT_SWIZZLE(v1, 3, 3, 0, 0), v2),
+                              _mm_mul_ps(GDT_SWIZZLE(v1, 1, 1, 2, 2), GDT_SWIZZLE(v2, 2, 3, 0, 1)));
         }
-        return false;
-    }
 
-    Matrix4f Matrix4f::operator*(const Matrix4f& m) const {
-        Matrix4f dest;
-        dest.a[0] = a[0] * m.a[0] + a[4] * m.a[1] + a[8] * m.a[2] + a[12] * m.a[3];
-        dest.a[1] = a[1] * m.a[0] + a[5] * m.a[1] + a[9] * m.a[2] + a[13] * m.a[3];
-        dest.a[2] = a[2] * m.a[0] + a[6] * m.a[1] + a[10] * m.a[2] + a[14] * m.a[3];
-        dest.a[3] = a[3] * m.a[0] + a[7] * m.a[1] + a[11] * m.a[2] + a[15] * m.a[3];
-
-        dest.a[4] = a[0] * m.a[4] + a[4] * m.a[5] + a[8] * m.a[6] + a[12] * m.a[7];
-        dest.a[5] = a[1] * m.a[4] + a[5] * m.a[5] + a[9] * m.a[6] + a[13] * m.a[7];
-        dest.a[6] = a[2] * m.a[4] + a[6] * m.a[5] + a[10] * m.a[6] + a[14] * m.a[7];
-        dest.a[7] = a[3] * m.a[4] + a[7] * m.a[5] + a[11] * m.a[6] + a[15] * m.a[7];
-
-        dest.a[8] = a[0] * m.a[8] + a[4] * m.a[9] + a[8] * m.a[10] + a[12] * m.a[11];
-        dest.a[9] = a[1] * m.a[8] + a[5] * m.a[9] + a[9] * m.a[10] + a[13] * m.a[11];
-        dest.a[10] = a[2] * m.a[8] + a[6] * m.a[9] + a[10] * m.a[10] + a[14] * m.a[11];
-        dest.a[11] = a[3] * m.a[8] + a[7] * m.a[9] + a[11] * m.a[10] + a[15] * m.a[11];
-
-        dest.a[12] = a[0] * m.a[12] + a[4] * m.a[13] + a[8] * m.a[14] + a[12] * m.a[15];
-        dest.a[13] = a[1] * m.a[12] + a[5] * m.a[13] + a[9] * m.a[14] + a[13] * m.a[15];
-        dest.a[14] = a[2] * m.a[12] + a[6] * m.a[13] + a[10] * m.a[14] + a[14] * m.a[15];
-        dest.a[15] = a[3] * m.a[12] + a[7] * m.a[13] + a[11] * m.a[14] + a[15] * m.a[15];
-
-        return dest;
-    }
+        inline __m128 mat2MulAdj(__m128 v1, __m128 v2) // v1 * v2#
+        {
+            return _mm_sub_ps(_mm_mul_ps(v1, GDT_SWIZZLE(v2, 3, 0, 3, 0)),
+                              _mm_mul_ps(GDT_SWIZZLE(v1, 1, 0, 3, 2), GDT_SWIZZLE(v2, 2, 1, 2, 1)));
+        }
+
+        // Block-wise inverse of [A B; C D] built from 2x2 adjugates
+        void inverseSSE(const float* m, float* d)
+        {
+            __m128 r0 = _mm_loadu_ps(&m[0]);
+            __m128 r1 = _mm_loadu_ps(&m[4]);
+            __m128 r2 = _mm_loadu_ps(&m[8]);
+            __m128 r3 = _mm_loadu_ps(&m[12]);
+
+            __m128 A = _mm_movelh_ps(r0, r1);
+            __m128 B = _mm_movehl_ps(r1, r0);
+            __m128 C = _mm_movelh_ps(r2, r3);
+            __m128 D = _mm_movehl_ps(r3, r2);
+
+            // Determinants of the blocks as (|A|, |B|, |C|, |D|)
+            __m128 detSub = _mm_sub_ps(
+                _mm_mul_ps(GDT_SHUFFLE(r0, r2, 0, 2, 0, 2), GDT_SHUFFLE(r1, r3, 1, 3, 1, 3)),
+                _mm_mul_ps(GDT_SHUFFLE(r0, r2, 1, 3, 1, 3), GDT_SHUFFLE(r1, r3, 0, 2, 0, 2)));
+            __m128 detA = GDT_SWIZZLE(detSub, 0, 0, 0, 0);
+            __m128 detB = GDT_SWIZZLE(detSub, 1, 1, 1, 1);
+            __m128 detC = GDT_SWIZZLE(detSub, 2, 2, 2, 2);
+            __m128 detD = GDT_SWIZZLE(detSub, 3, 3, 3, 3);
+
+            __m128 DC = mat2AdjMul(D, C);
+            __m128 AB = mat2AdjMul(A, B);
+
+            __m128 X = _mm_sub_ps(_mm_mul_ps(detD, A), mat2Mul(B, DC));
+            __m128 W = _mm_sub_ps(_mm_mul_ps(detA, D), mat2Mul(C, AB));
+            __m128 Y = _mm_sub_ps(_mm_mul_ps(detB, C), mat2MulAdj(D, AB));
+            __m128 Z = _mm_sub_ps(_mm_mul_ps(detC, B), mat2MulAdj(A, DC));
+
+            // |M| = |A||D| + |B||C| - tr((A#B)(D#C))
+            __m128 tr = _mm_mul_ps(AB, GDT_SWIZZLE(DC, 0, 2, 1, 3));
+            tr = _mm_add_ps(tr, GDT_SWIZZLE(tr, 2, 3, 0, 1));
+            tr = _mm_add_ps(tr, GDT_SWIZZLE(tr, 1, 0, 3, 2));
+            __m128 detM = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), tr);
+
+            __m128 rDetM = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), detM);
+
+            X = _mm_mul_ps(X, rDetM);
+            Y = _mm_mul_ps(Y, rDetM);
+            Z = _mm_mul_ps(Z, rDetM);
+            W = _mm_mul_ps(W, rDetM);
+
+            // Apply the adjugate of the blocks while storing
+            _mm_storeu_ps(&d[0], GDT_SHUFFLE(X, Y, 3, 1, 3, 1));
+            _mm_storeu_ps(&d[4], GDT_SHUFFLE(X, Y, 2, 0, 2, 0));
+            _mm_storeu_ps(&d[8], GDT_SHUFFLE(Z, W, 3, 1, 3, 1));
+            _mm_storeu_ps(&d[12], GDT_SHUFFLE(Z, W, 2, 0, 2, 0));
+        }
 
-    Vector4f Matrix4f::operator*(const Vector4f& v) const {
-        Vector4f dest;
-        dest.x = a[0] * v.x + a[4] * v.y + a[8] * v.z + a[12] * v.w;
-        dest.y = a[1] * v.x + a[5] * v.y + a[9] * v.z + a[13] * v.w;
-        dest.z = a[2] * v.x + a[6] * v.y + a[10] * v.z + a[14] * v.w;
-        dest.w = a[3] * v.x + a[7] * v.y + a[11] * v.z + a[15] * v.w;
-        return dest;
+#undef GDT_SWIZZLE
+#undef GDT_SHUFFLE
+#endif
     }
 
-    Vector3f Matrix4f::operator*(const Vector3f& v) const {
-        Vector3f dest;
-        dest.x = a[0] * v.x + a[4] * v.y + a[8] * v.z;
-        dest.y = a[1] * v.x + a[5] * v.y + a[9] * v.z;
-        dest.z = a[2] * v.x + a[6] * v.y + a[10] * v.z;
-        return dest;
+    float determinant(const Matrix4f& m) {
+        return SubDeterminants(m.toArray()).determinant();
     }
 
-    Matrix4f transpose(const Matrix4f& m) {
+    Matrix4f inverse(const Matrix4f& m) {
         Matrix4f d;
-        d[0] = m[0];	d[4] = m[1];	d[8] = m[2];	d[12] = m[3];
-        d[1] = m[4];	d[5] = m[5];	d[9] = m[6];	d[13] = m[7];
-        d[2] = m[8];	d[6] = m[9];	d[10] = m[10];	d[14] = m[11];
-        d[3] = m[12];	d[7] = m[13];	d[11] = m[14];	d[15] = m[15];
+#if defined(GDT_SIMD_SSE)
+        inverseSSE(m.toArray(), d.toArray());
+#else
+        SubDeterminants sd(m.toArray());
+        float invDet = 1 / sd.determinant();
+
+        d[0] = (m[5] * sd.c5 - m[6] * sd.c4 + m[7] * sd.c3) * invDet;
+        d[1] = (-m[1] * sd.c5 + m[2] * sd.c4 - m[3] * sd.c3) * invDet;
+        d[2] = (m[13] * sd.s5 - m[14] * sd.s4 + m[15] * sd.s3) * invDet;
+        d[3] = (-m[9] * sd.s5 + m[10] * sd.s4 - m[11] * sd.s3) * invDet;
+
+        d[4] = (-m[4] * sd.c5 + m[6] * sd.c2 - m[7] * sd.c1) * invDet;
+        d[5] = (m[0] * sd.c5 - m[2] * sd.c2 + m[3] * sd.c1) * invDet;
+        d[6] = (-m[12] * sd.s5 + m[14] * sd.s2 - m[15] * sd.s1) * invDet;
+        d[7] = (m[8] * sd.s5 - m[10] * sd.s2 + m[11] * sd.s1) * invDet;
+
+        d[8] = (m[4] * sd.c4 - m[5] * sd.c2 + m[7] * sd.c0) * invDet;
+        d[9] = (-m[0] * sd.c4 + m[1] * sd.c2 - m[3] * sd.c0) * invDet;
+        d[10] = (m[12] * sd.s4 - m[13] * sd.s2 + m[15] * sd.s0) * invDet;
+        d[11] = (-m[8] * sd.s4 + m[9] * sd.s2 - m[11] * sd.s0) * invDet;
+
+        d[12] = (-m[4] * sd.c3 + m[5] * sd.c1 - m[6] * sd.c0) * invDet;
+        d[13] = (m[0] * sd.c3 - m[1] * sd.c1 + m[2] * sd.c0) * invDet;
+        d[14] = (-m[12] * sd.s3 + m[13] * sd.s1 - m[14] * sd.s0) * invDet;
+        d[15] = (m[8] * sd.s3 - m[9] * sd.s1 + m[10] * sd.s0) * invDet;
+#endif
         return d;
     }
 
-    float determinant(const Matrix4f& m) {
-        float det =
-            m[0] * m[5] * m[10] * m[15] + m[0] * m[9] * m[14] * m[7] +
-            m[0] * m[13] * m[6] * m[11] + m[4] * m[1] * m[14] * m[11] +
-            m[4] * m[9] * m[2] * m[15] + m[4] * m[13] * m[10] * m[3] +
-            m[8] * m[1] * m[6] * m[15] + m[8] * m[5] * m[14] * m[3] +
-            m[8] * m[13] * m[2] * m[7] + m[12] * m[1] * m[10] * m[7] +
-            m[12] * m[5] * m[2] * m[11] + m[12] * m[9] * m[6] * m[3] -
-            m[0] * m[5] * m[14] * m[11] - m[0] * m[9] * m[6] * m[15] -
-            m[0] * m[13] * m[10] * m[7] - m[4] * m[1] * m[10] * m[15] -
-            m[4] * m[9] * m[14] * m[3] - m[4] * m[13] * m[2] * m[11] -
-            m[8] * m[1] * m[14] * m[7] - m[8] * m[5] * m[2] * m[15] -
-            m[8] * m[13] * m[6] * m[3] - m[12] * m[1] * m[6] * m[11] -
-            m[12] * m[5] * m[10] * m[3] - m[12] * m[9] * m[2] * m[7];
-
-        return det;
-    }
+    Matrix4f inverseAffine(const Matrix4f& m) {
+        // The rows of the inverse 3x3 part are the cross products of its columns over the determinant
+        float r0x = m[5] * m[10] - m[6] * m[9];
+        float r0y = m[6] * m[8] - m[4] * m[10];
+        float r0z = m[4] * m[9] - m[5] * m[8];
 
-    Matrix4f inverse(const Matrix4f& m) {
-        float det = determinant(m);
+        float r1x = m[9] * m[2] - m[10] * m[1];
+        float r1y = m[10] * m[0] - m[8] * m[2];
+        float r1z = m[8] * m[1] - m[9] * m[0];
+
+        float r2x = m[1] * m[6] - m[2] * m[5];
+        float r2y = m[2] * m[4] - m[0] * m[6];
+        float r2z = m[0] * m[5] - m[1] * m[4];
+
+        float invDet = 1 / (m[0] * r0x + m[1] * r0y + m[2] * r0z);
+
+        Matrix4f d;
+        d[0] = r0x * invDet; d[4] = r0y * invDet; d[8] = r0z * invDet;
+        d[1] = r1x * invDet; d[5] = r1y * invDet; d[9] = r1z * invDet;
+        d[2] = r2x * invDet; d[6] = r2y * invDet; d[10] = r2z * invDet;
+
+        d[12] = -(d[0] * m[12] + d[4] * m[13] + d[8] * m[14]);
+        d[13] = -(d[1] * m[12] + d[5] * m[13] + d[9] * m[14]);
+        d[14] = -(d[2] * m[12] + d[6] * m[13] + d[10] * m[14]);
+        return d;
+    }
 
+    Matrix4f inverseRigid(const Matrix4f& m) {
         Matrix4f d;
-        d[0] = m[5] * m[10] * m[15] + m[9] * m[14] * m[7] + m[13] * m[6] * m[11]
-            - m[5] * m[14] * m[11] - m[9] * m[6] * m[15] - m[13] * m[10] * m[7];
-        d[1] = m[1] * m[14] * m[11] + m[9] * m[2] * m[15] + m[13] * m[10] * m[3]
-            - m[1] * m[10] * m[15] - m[9] * m[14] * m[3] - m[13] * m[2] * m[11];
-        d[2] = m[1] * m[6] * m[15] + m[5] * m[14] * m[3] + m[13] * m[2] * m[7]
-            - m[1] * m[14] * m[7] - m[5] * m[2] * m[15] - m[13] * m[6] * m[3];
-        d[3] = m[1] * m[10] * m[7] + m[5] * m[2] * m[11] + m[9] * m[6] * m[3]
-            - m[1] * m[6] * m[11] - m[5] * m[10] * m[3] - m[9] * m[2] * m[7];
-        d[4] = m[4] * m[14] * m[11] + m[8] * m[6] * m[15] + m[12] * m[10] * m[7]
-            - m[4] * m[10] * m[15] - m[8] * m[14] * m[7] - m[12] * m[6] * m[11];
-        d[5] = m[0] * m[10] * m[15] + m[8] * m[14] * m[3] + m[12] * m[2] * m[11]
-            - m[0] * m[14] * m[11] - m[8] * m[2] * m[15] - m[12] * m[10] * m[3];
-        d[6] = m[0] * m[14] * m[7] + m[4] * m[2] * m[15] + m[12] * m[6] * m[3]
-            - m[0] * m[6] * m[15] - m[4] * m[14] * m[3] - m[12] * m[2] * m[7];
-        d[7] = m[0] * m[6] * m[11] + m[4] * m[10] * m[3] + m[8] * m[2] * m[7]
-            - m[0] * m[10] * m[7] - m[4] * m[2] * m[11] - m[8] * m[6] * m[3];
-        d[8] = m[4] * m[9] * m[15] + m[8] * m[13] * m[7] + m[12] * m[5] * m[11]
-            - m[4] * m[13] * m[11] - m[8] * m[5] * m[15] - m[12] * m[9] * m[7];
-        d[9] = m[0] * m[13] * m[11] + m[8] * m[1] * m[15] + m[12] * m[9] * m[3]
-            - m[0] * m[9] * m[15] - m[8] * m[13] * m[3] - m[12] * m[1] * m[11];
-        d[10] = m[0] * m[5] * m[15] + m[4] * m[13] * m[3] + m[12] * m[1] * m[7]
-            - m[0] * m[13] * m[7] - m[4] * m[1] * m[15] - m[12] * m[5] * m[3];
-        d[11] = m[0] * m[9] * m[7] + m[4] * m[1] * m[11] + m[8] * m[5] * m[3]
-            - m[0] * m[5] * m[11] - m[4] * m[9] * m[3] - m[8] * m[1] * m[7];
-        d[12] = m[4] * m[13] * m[10] + m[8] * m[5] * m[14] + m[12] * m[9] * m[6]
-            - m[4] * m[9] * m[14] - m[8] * m[13] * m[6] - m[12] * m[5] * m[10];
-        d[13] = m[0] * m[9] * m[14] + m[8] * m[13] * m[2] + m[12] * m[1] * m[10]
-            - m[0] * m[13] * m[10] - m[8] * m[1] * m[14] - m[12] * m[9] * m[2];
-        d[14] = m[0] * m[13] * m[6] + m[4] * m[1] * m[14] + m[12] * m[5] * m[2]
-            - m[0] * m[5] * m[14] - m[4] * m[13] * m[2] - m[12] * m[1] * m[6];
-        d[15] = m[0] * m[5] * m[10] + m[4] * m[9] * m[2] + m[8] * m[1] * m[6]
-            - m[0] * m[9] * m[6] - m[4] * m[1] * m[10] - m[8] * m[5] * m[2];
-
-        d.scale(1 / det);
+        d[0] = m[0]; d[4] = m[1]; d[8] = m[2];
+        d[1] = m[4]; d[5] = m[5]; d[9] = m[6];
+        d[2] = m[8]; d[6] = m[9]; d[10] = m[10];
 
+        d[12] = -(m[0] * m[12] + m[1] * m[13] + m[2] * m[14]);
+        d[13] = -(m[4] * m[12] + m[5] * m[13] + m[6] * m[14]);
+        d[14] = -(m[8] * m[12] + m[9] * m[13] + m[10] * m[14]);
         return d;
     }
 
@@ -1,13 +1,17 @@
 #pragma once
 
+#include "Vector3f.h"
+#include "Vector4f.h"
+#include "Simd.h"
+
+#include <cstddef>
 #include <string>
 
 #ifdef GDT_NAMESPACE
 namespace GDT
 {
 #endif
-    class Vector3f;
-    class Vector4f;
+    class Quaternionf;
 
     class Matrix4f {
     public:
@@ -15,36 +19,60 @@ namespace GDT
         static const Matrix4f BIAS;
 
         /* Core */
-        Matrix4f();
-        Matrix4f(Vector3f t, Vector3f b, Vector3f n);
+        constexpr Matrix4f();
+        constexpr Matrix4f(Vector3f t, Vector3f b, Vector3f n);
+
+        /* Builds a matrix from its elements in column-major order, usable in constant expressions */
+        static constexpr Matrix4f fromColumns(float m0, float m1, float m2, float m3,
+            float m4, float m5, float m6, float m7,
+            float m8, float m9, float m10, float m11,
+            float m12, float m13, float m14, float m15);
 
-        void setIdentity();
-        void translate(const Vector3f& v);
+        inline void setIdentity();
+        inline void translate(const Vector3f& v);
         void rotate(float angle, float x, float y, float z);
         void rotate(const Vector3f& euler);
-        void scale(float scale);
-        void scale(const Vector3f& scale);
-        Vector3f transform(const Vector3f& v, int w) const;
+        void rotate(const Quaternionf& q);
+        inline void scale(float scale);
+        inline void scale(const Vector3f& scale);
+        inline Vector3f transform(const Vector3f& v, int w) const;
+
+        /* Batch transforms, points are divided by w and directions ignore the translation.
+           Strided overloads read x, y, z from the start of every stride bytes of the input.
+           Output may alias the input and large batches are split across threads. */
+        void transformPoints(const Vector3f* in, Vector3f* out, size_t count) const;
+        void transformPoints(const void* in, size_t stride, Vector3f* out, size_t count) const;
+        void transformPoints(Vector3f* points, size_t count) const;
+        void transformDirections(const Vector3f* in, Vector3f* out, size_t count) const;
+        void transformDirections(const void* in, size_t stride, Vector3f* out, size_t count) const;
+        void transformDirections(Vector3f* directions, size_t count) const;
+        void transform(const Vector4f* in, Vector4f* out, size_t count) const;
+        void transform(Vector4f* v, size_t count) const;
 
-        const float* toArray() const;
-        float* toArray();
+        constexpr const float* toArray() const;
+        inline float* toArray();
         std::string str() const;
 
         /* Operator overloads */
-        float operator[](int i) const;
-        float& operator[](int i);
-        bool operator==(const Matrix4f& m) const;
-        bool operator!=(const Matrix4f& m) const;
-        Matrix4f operator*(const Matrix4f& m) const;
-        Vector4f operator*(const Vector4f& v) const;
-        Vector3f operator*(const Vector3f& v) const;
+        constexpr float operator[](int i) const;
+        inline float& operator[](int i);
+        inline bool operator==(const Matrix4f& m) const;
+        inline bool operator!=(const Matrix4f& m) const;
+        inline Matrix4f operator*(const Matrix4f& m) const;
+        inline Vector4f operator*(const Vector4f& v) const;
+        inline Vector3f operator*(const Vector3f& v) const;
     private:
-        Matrix4f(float m0, float m1, float m2, float m3,
+        struct Uninitialized {};
+
+        /* Leaves the elements uninitialized, for results that overwrite all of them */
+        inline Matrix4f(Uninitialized);
+
+        constexpr Matrix4f(float m0, float m1, float m2, float m3,
             float m4, float m5, float m6, float m7,
             float m8, float m9, float m10, float m11,
             float m12, float m13, float m14, float m15);
 
-        float a[16];
+        GDT_SIMD_ALIGN float a[16];
     };
 
 
@@ -53,7 +81,15 @@ namespace GDT
     float determinant(const Matrix4f& m);
     Matrix4f inverse(const Matrix4f& m);
 
+    /* Inverse of a matrix whose last row is (0, 0, 0, 1) */
+    Matrix4f inverseAffine(const Matrix4f& m);
+
+    /* Inverse of a matrix that only rotates and translates */
+    Matrix4f inverseRigid(const Matrix4f& m);
+
     std::ostream& operator<<(std::ostream& os, const Matrix4f& m);
 #ifdef GDT_NAMESPACE
 }
 #endif
+
+#include "Matrix4f.inl"
@@ -0,0 +1,219 @@
+#ifdef GDT_NAMESPACE
+namespace GDT
+{
+#endif
+    /* Core */
+    constexpr Matrix4f::Matrix4f() :
+        a{ 1, 0, 0, 0,
+           0, 1, 0, 0,
+           0, 0, 1, 0,
+           0, 0, 0, 1 }
+    {
+
+    }
+
+    constexpr Matrix4f::Matrix4f(Vector3f t, Vector3f b, Vector3f n) :
+        Matrix4f(t.x, b.x, n.x, 0,
+                 t.y, b.y, n.y, 0,
+                 t.z, b.z, n.z, 0,
+                 0, 0, 0, 1)
+    {
+
+    }
+
+    Matrix4f::Matrix4f(Uninitialized) {
+
+    }
+
+    constexpr Matrix4f::Matrix4f(float m0, float m1, float m2, float m3,
+        float m4, float m5, float m6, float m7,
+        float m8, float m9, float m10, float m11,
+        float m12, float m13, float m14, float m15) :
+        a{ m0, m1, m2, m3,
+           m4, m5, m6, m7,
+           m8, m9, m10, m11,
+           m12, m13, m14, m15 }
+    {
+
+    }
+
+    constexpr Matrix4f Matrix4f::fromColumns(float m0, float m1, float m2, float m3,
+        float m4, float m5, float m6, float m7,
+        float m8, float m9, float m10, float m11,
+        float m12, float m13, float m14, float m15) {
+        return Matrix4f(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15);
+    }
+
+    void Matrix4f::setIdentity() {
+        a[0] = 1;  a[1] = 0;  a[2] = 0;  a[3] = 0;
+        a[4] = 0;  a[5] = 1;  a[6] = 0;  a[7] = 0;
+        a[8] = 0;  a[9] = 0;  a[10] = 1; a[11] = 0;
+        a[12] = 0; a[13] = 0; a[14] = 0; a[15] = 1;
+    }
+
+    void Matrix4f::translate(const Vector3f& v) {
+        a[12] += a[0] * v.x + a[4] * v.y + a[8] * v.z;
+        a[13] += a[1] * v.x + a[5] * v.y + a[9] * v.z;
+        a[14] += a[2] * v.x + a[6] * v.y + a[10] * v.z;
+        a[15] += a[3] * v.x + a[7] * v.y + a[11] * v.z;
+    }
+
+    void Matrix4f::scale(float scale) {
+        a[0] *= scale;
+        a[1] *= scale;
+        a[2] *= scale;
+        a[3] *= scale;
+        a[4] *= scale;
+        a[5] *= scale;
+        a[6] *= scale;
+        a[7] *= scale;
+        a[8] *= scale;
+        a[9] *= scale;
+        a[10] *= scale;
+        a[11] *= scale;
+    }
+
+    void Matrix4f::scale(const Vector3f& scale) {
+        a[0] *= scale.x;
+        a[1] *= scale.x;
+        a[2] *= scale.x;
+        a[3] *= scale.x;
+        a[4] *= scale.y;
+        a[5] *= scale.y;
+        a[6] *= scale.y;
+        a[7] *= scale.y;
+        a[8] *= scale.z;
+        a[9] *= scale.z;
+        a[10] *= scale.z;
+        a[11] *= scale.z;
+    }
+
+    Vector3f Matrix4f::transform(const Vector3f& v, int w) const {
+        Vector3f dest;
+        dest.x = a[0] * v.x + a[4] * v.y + a[8] * v.z + a[12] * w;
+        dest.y = a[1] * v.x + a[5] * v.y + a[9] * v.z + a[13] * w;
+        dest.z = a[2] * v.x + a[6] * v.y + a[10] * v.z + a[14] * w;
+        float dest_w = a[3] * v.x + a[7] * v.y + a[11] * v.z + a[15] * w;
+        return w == 0 ? dest : dest / dest_w;
+    }
+
+    constexpr const float* Matrix4f::toArray() const {
+        return a;
+    }
+
+    float* Matrix4f::toArray() {
+        return a;
+    }
+
+
+    /* Operator overloads */
+    constexpr float Matrix4f::operator[](int i) const {
+        return a[i];
+    }
+
+    float& Matrix4f::operator[](int i) {
+        return a[i];
+    }
+
+    bool Matrix4f::operator==(const Matrix4f& m) const {
+        for (int i = 0; i < 16; i++) {
+            if (a[i] != m.a[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool Matrix4f::operator!=(const Matrix4f& m) const {
+        for (int i = 0; i < 16; i++) {
+            if (a[i] != m.a[i]) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // The SIMD paths compute every result column as a linear combination of
+    // the columns of this matrix, accumulating in the same order as the
+    // scalar path so all backends produce bit-identical results.
+    Matrix4f Matrix4f::operator*(const Matrix4f& m) const {
+        Matrix4f dest(Uninitialized{});
+#if defined(GDT_SIMD_AVX)
+        // Duplicate each column in both 128-bit lanes so two result columns are computed at once
+        __m256 c0 = _mm256_broadcast_ps((const __m128*) &a[0]);
+        __m256 c1 = _mm256_broadcast_ps((const __m128*) &a[4]);
+        __m256 c2 = _mm256_broadcast_ps((const __m128*) &a[8]);
+        __m256 c3 = _mm256_broadcast_ps((const __m128*) &a[12]);
+
+        for (int i = 0; i < 16; i += 8) {
+            __m256 b = _mm256_loadu_ps(&m.a[i]);
+            __m256 r = _mm256_mul_ps(c0, _mm256_shuffle_ps(b, b, _MM_SHUFFLE(0, 0, 0, 0)));
+            r = _mm256_add_ps(r, _mm256_mul_ps(c1, _mm256_shuffle_ps(b, b, _MM_SHUFFLE(1, 1, 1, 1))));
+            r = _mm256_add_ps(r, _mm256_mul_ps(c2, _mm256_shuffle_ps(b, b, _MM_SHUFFLE(2, 2, 2, 2))));
+            r = _mm256_add_ps(r, _mm256_mul_ps(c3, _mm256_shuffle_ps(b, b, _MM_SHUFFLE(3, 3, 3, 3))));
+            _mm256_storeu_ps(&dest.a[i], r);
+        }
+#elif defined(GDT_SIMD_FLOAT4)
+        Simd::Float4 c0 = Simd::load(&a[0]);
+        Simd::Float4 c1 = Simd::load(&a[4]);
+        Simd::Float4 c2 = Simd::load(&a[8]);
+        Simd::Float4 c3 = Simd::load(&a[12]);
+
+        for (int i = 0; i < 16; i += 4) {
+            Simd::Float4 r = Simd::mul(c0, Simd::set1(m.a[i]));
+            r = Simd::add(r, Simd::mul(c1, Simd::set1(m.a[i + 1])));
+            r = Simd::add(r, Simd::mul(c2, Simd::set1(m.a[i + 2])));
+            r = Simd::add(r, Simd::mul(c3, Simd::set1(m.a[i + 3])));
+            Simd::store(&dest.a[i], r);
+        }
+#else
+        dest.a[0] = a[0] * m.a[0] + a[4] * m.a[1] + a[8] * m.a[2] + a[12] * m.a[3];
+        dest.a[1] = a[1] * m.a[0] + a[5] * m.a[1] + a[9] * m.a[2] + a[13] * m.a[3];
+        dest.a[2] = a[2] * m.a[0] + a[6] * m.a[1] + a[10] * m.a[2] + a[14] * m.a[3];
+        dest.a[3] = a[3] * m.a[0] + a[7] * m.a[1] + a[11] * m.a[2] + a[15] * m.a[3];
+
+        dest.a[4] = a[0] * m.a[4] + a[4] * m.a[5] + a[8] * m.a[6] + a[12] * m.a[7];
+        dest.a[5] = a[1] * m.a[4] + a[5] * m.a[5] + a[9] * m.a[6] + a[13] * m.a[7];
+        dest.a[6] = a[2] * m.a[4] + a[6] * m.a[5] + a[10] * m.a[6] + a[14] * m.a[7];
+        dest.a[7] = a[3] * m.a[4] + a[7] * m.a[5] + a[11] * m.a[6] + a[15] * m.a[7];
+
+        dest.a[8] = a[0] * m.a[8] + a[4] * m.a[9] + a[8] * m.a[10] + a[12] * m.a[11];
+        dest.a[9] = a[1] * m.a[8] + a[5] * m.a[9] + a[9] * m.a[10] + a[13] * m.a[11];
+        dest.a[10] = a[2] * m.a[8] + a[6] * m.a[9] + a[10] * m.a[10] + a[14] * m.a[11];
+        dest.a[11] = a[3] * m.a[8] + a[7] * m.a[9] + a[11] * m.a[10] + a[15] * m.a[11];
+
+        dest.a[12] = a[0] * m.a[12] + a[4] * m.a[13] + a[8] * m.a[14] + a[12] * m.a[15];
+        dest.a[13] = a[1] * m.a[12] + a[5] * m.a[13] + a[9] * m.a[14] + a[13] * m.a[15];
+        dest.a[14] = a[2] * m.a[12] + a[6] * m.a[13] + a[10] * m.a[14] + a[14] * m.a[15];
+        dest.a[15] = a[3] * m.a[12] + a[7] * m.a[13] + a[11] * m.a[14] + a[15] * m.a[15];
+#endif
+        return dest;
+    }
+
+    Vector4f Matrix4f::operator*(const Vector4f& v) const {
+        Vector4f dest;
+#if defined(GDT_SIMD_FLOAT4)
+        Simd::Float4 r = Simd::mul(Simd::load(&a[0]), Simd::set1(v.x));
+        r = Simd::add(r, Simd::mul(Simd::load(&a[4]), Simd::set1(v.y)));
+        r = Simd::add(r, Simd::mul(Simd::load(&a[8]), Simd::set1(v.z)));
+        r = Simd::add(r, Simd::mul(Simd::load(&a[12]), Simd::set1(v.w)));
+        Simd::store(dest.a, r);
+#else
+        dest.x = a[0] * v.x + a[4] * v.y + a[8] * v.z + a[12] * v.w;
+        dest.y = a[1] * v.x + a[5] * v.y + a[9] * v.z + a[13] * v.w;
+        dest.z = a[2] * v.x + a[6] * v.y + a[10] * v.z + a[14] * v.w;
+        dest.w = a[3] * v.x + a[7] * v.y + a[11] * v.z + a[15] * v.w;
+#endif
+        return dest;
+    }
+
+    Vector3f Matrix4f::operator*(const Vector3f& v) const {
+        Vector3f dest;
+        dest.x = a[0] * v.x + a[4] * v.y + a[8] * v.z;
+        dest.y = a[1] * v.x + a[5] * v.y + a[9] * v.z;
+        dest.z = a[2] * v.x + a[6] * v.y + a[10] * v.z;
+        return dest;
+    }
+#ifdef GDT_NAMESPACE
+}
+#endif
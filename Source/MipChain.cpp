@@ -0,0 +1,354 @@
+#include "MipChain.h"
+
+#include "Parallel.h"
+#include "Simd.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+#ifdef GDT_NAMESPACE
+namespace GDT
+{
+#endif
+    namespace
+    {
+        const double PI = 3.14159265358979323846;
+
+        // Half the width of the Kaiser filter in pixels of the lower level, and the shape of its window
+        const double KAISER_RADIUS = 1.5;
+        const double KAISER_ALPHA = 4.0;
+
+        // Pixels worth handing to a thread of their own
+        const size_t GRAIN_PIXELS = 16384;
+
+        // Steps of the search for the alpha scale that preserves coverage
+        const int COVERAGE_STEPS = 16;
+
+        // Source pixels and their weights contributing to every pixel along one axis of the lower level
+        struct AxisWeights
+        {
+            // Taps of pixel i are [start[i], start[i + 1])
+            std::vector<size_t> start;
+            std::vector<uint> source;
+            std::vector<float> weight;
+        };
+
+        double sinc(double x)
+        {
+            if (std::abs(x) < 1e-9)
+                return 1;
+            return std::sin(PI * x) / (PI * x);
+        }
+
+        // Modified Bessel function of the first kind of order zero, as a power series
+        double bessel0(double x)
+        {
+            double sum = 1, term = 1;
+            for (int k = 1; k < 32; k++)
+            {
+                term *= (x / (2 * k)) * (x / (2 * k));
+                sum += term;
+                if (term < sum * 1e-12)
+                    break;
+            }
+            return sum;
+        }
+
+        double kaiser(double x)
+        {
+            double t = x / KAISER_RADIUS;
+            if (t * t >= 1)
+                return 0;
+            return sinc(x) * bessel0(KAISER_ALPHA * std::sqrt(1 - t * t)) / bessel0(KAISER_ALPHA);
+        }
+
+        uint wrapIndex(long index, uint size, bool repeat)
+        {
+            if (repeat)
+                return (uint) (((index % (long) size) + size) % size);
+            return (uint) std::min(std::max(index, 0L), (long) size - 1);
+        }
+
+        AxisWeights computeWeights(uint sourceSize, uint size, const MipOptions& options)
+        {
+            AxisWeights weights;
+            double scale = (double) sourceSize / size;
+
+            for (uint i = 0; i < size; i++)
+            {
+                weights.start.push_back(weights.source.size());
+                size_t first = weights.source.size();
+                double sum = 0;
+
+                if (options.filter == MipFilter::BOX)
+                {
+                    // Weigh the source pixels by how much of them the pixel covers
+                    double low = i * scale, high = (i + 1) * scale;
+                    for (long s = (long) std::floor(low); s < (long) std::ceil(high); s++)
+                    {
+                        double overlap = std::min(high, s + 1.0) - std::max(low, (double) s);
+                        if (overlap <= 0)
+                            continue;
+
+                        weights.source.push_back(wrapIndex(s, sourceSize, options.repeat));
+                        weights.weight.push_back((float) overlap);
+                        sum += overlap;
+                    }
+                }
+                else
+                {
+                    double center = (i + 0.5) * scale;
+                    double radius = KAISER_RADIUS * scale;
+                    for (long s = (long) std::floor(center - radius); s <= (long) std::ceil(center + radius); s++)
+                    {
+                        double w = kaiser((s + 0.5 - center) / scale);
+                        if (w == 0)
+                            continue;
+
+                        weights.source.push_back(wrapIndex(s, sourceSize, options.repeat));
+                        weights.weight.push_back((float) w);
+                        sum += w;
+                    }
+                }
+
+                for (size_t t = first; t < weights.weight.size(); t++)
+                    weights.weight[t] = (float) (weights.weight[t] / sum);
+            }
+            weights.start.push_back(weights.source.size());
+
+            return weights;
+        }
+
+        size_t grainRows(uint width)
+        {
+            return std::max<size_t>(1, GRAIN_PIXELS / std::max(width, 1u));
+        }
+
+        // Filters every row of an RGBA float image down to the width of the weights
+        void filterRows(const float* source, uint sourceWidth, uint height, const AxisWeights& weights, float* destination, uint width)
+        {
+            Parallel::forRange(height, grainRows(width), [=, &weights](size_t begin, size_t end) {
+                for (size_t y = begin; y < end; y++)
+                {
+                    const float* row = source + y * sourceWidth * 4;
+                    float* out = destination + y * width * 4;
+
+                    for (uint x = 0; x < width; x++)
+                    {
+                        Simd::Float4 sum = Simd::set1(0);
+                        for (size_t t = weights.start[x]; t < weights.start[x + 1]; t++)
+                            sum = Simd::add(sum, Simd::mul(Simd::load(row + weights.source[t] * 4), Simd::set1(weights.weight[t])));
+                        Simd::store(out + x * 4, sum);
+                    }
+                }
+            });
+        }
+
+        // Filters the columns of an RGBA float image down to the height of the weights, a whole row at a time
+        void filterColumns(const float* source, uint width, const AxisWeights& weights, float* destination, uint height)
+        {
+            Parallel::forRange(height, grainRows(width), [=, &weights](size_t begin, size_t end) {
+                for (size_t y = begin; y < end; y++)
+                {
+                    float* out = destination + y * width * 4;
+                    std::fill(out, out + width * 4, 0.0f);
+
+                    for (size_t t = weights.start[y]; t < weights.start[y + 1]; t++)
+                    {
+                        const float* row = source + weights.source[t] * width * 4;
+                        Simd::Float4 weight = Simd::set1(weights.weight[t]);
+
+                        for (uint x = 0; x < width; x++)
+                            Simd::store(out + x * 4, Simd::add(Simd::load(out + x * 4), Simd::mul(Simd::load(row + x * 4), weight)));
+                    }
+                }
+            });
+        }
+
+        float decodeSRGB(float c)
+        {
+            return c <= 0.04045f ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f);
+        }
+
+        float encodeSRGB(float c)
+        {
+            return c <= 0.0031308f ? c * 12.92f : 1.055f * std::pow(c, 1 / 2.4f) - 0.055f;
+        }
+
+        unsigned char quantize(float c)
+        {
+            return (unsigned char) (std::min(std::max(c, 0.0f), 1.0f) * 255 + 0.5f);
+        }
+
+        // Number of alpha values above the reference after scaling them, the zero padding is never covered
+        size_t countCovered(const std::vector<float>& alpha, float scale, float reference)
+        {
+            std::atomic<size_t> total(0);
+
+            Parallel::forRange(alpha.size() / 4, GRAIN_PIXELS / 4, [&](size_t begin, size_t end) {
+                Simd::Float4 s = Simd::set1(scale);
+                Simd::Float4 r = Simd::set1(reference);
+
+                size_t count = 0;
+                for (size_t i = begin * 4; i < end * 4; i += 4)
+                {
+                    int mask = Simd::moveMask(Simd::greaterThan(Simd::mul(Simd::load(&alpha[i]), s), r));
+                    count += (mask & 1) + ((mask >> 1) & 1) + ((mask >> 2) & 1) + ((mask >> 3) & 1);
+                }
+                total += count;
+            });
+
+            return total;
+        }
+
+        // Finds the scale of the alpha values that covers the same fraction of the level as level 0 did
+        float findAlphaScale(const std::vector<float>& alpha, size_t pixelCount, float reference, double coverage)
+        {
+            float low = 0, high = 4;
+            for (int step = 0; step < COVERAGE_STEPS; step++)
+            {
+                float scale = (low + high) / 2;
+                if ((double) countCovered(alpha, scale, reference) / pixelCount < coverage)
+                    low = scale;
+                else
+                    high = scale;
+            }
+            return (low + high) / 2;
+        }
+    }
+
+    MipChain::MipChain() :
+        _sRGB(false)
+    {
+
+    }
+
+    void MipChain::generate(const unsigned char* pixels, uint width, uint height, const MipOptions& options)
+    {
+        if (width == 0 || height == 0)
+            throw std::invalid_argument("Mip chain of an empty image");
+
+        uint maxLevels = Texture2D::getMaxLevels(width, height);
+        uint levelCount = options.levels == 0 ? maxLevels : std::min(options.levels, maxLevels);
+
+        _sRGB = options.sRGB;
+        _levels.assign(levelCount, MipLevel());
+        _levels[0] = MipLevel{ width, height, std::vector<unsigned char>(pixels, pixels + (size_t) width * height * 4) };
+
+        if (levelCount == 1)
+            return;
+
+        float table[256];
+        for (int i = 0; i < 256; i++)
+            table[i] = options.sRGB ? decodeSRGB(i / 255.0f) : i / 255.0f;
+
+        size_t pixelCount = (size_t) width * height;
+        std::vector<float> level(pixelCount * 4);
+        Parallel::forRange(pixelCount, GRAIN_PIXELS, [&](size_t begin, size_t end) {
+            for (size_t i = begin * 4; i < end * 4; i += 4)
+            {
+                level[i + 0] = table[pixels[i + 0]];
+                level[i + 1] = table[pixels[i + 1]];
+                level[i + 2] = table[pixels[i + 2]];
+                level[i + 3] = pixels[i + 3] / 255.0f;
+            }
+        });
+
+        // Alpha is gathered into its own array padded to a multiple of 4, to test coverage 4 pixels at a time
+        bool preserveCoverage = options.alphaCoverage > 0;
+        std::vector<float> alpha;
+        double coverage = 0;
+        if (preserveCoverage)
+        {
+            alpha.assign((pixelCount + 3) / 4 * 4, 0.0f);
+            for (size_t i = 0; i < pixelCount; i++)
+                alpha[i] = level[i * 4 + 3];
+            coverage = (double) countCovered(alpha, 1, options.alphaCoverage) / pixelCount;
+        }
+
+        std::vector<float> rows, next;
+        uint levelWidth = width, levelHeight = height;
+
+        for (uint l = 1; l < levelCount; l++)
+        {
+            uint nextWidth = std::max(levelWidth / 2, 1u);
+            uint nextHeight = std::max(levelHeight / 2, 1u);
+
+            // An axis that is down to a single pixel is left as it is
+            const float* filtered = level.data();
+            if (nextWidth != levelWidth)
+            {
+                rows.resize((size_t) nextWidth * levelHeight * 4);
+                filterRows(level.data(), levelWidth, levelHeight, computeWeights(levelWidth, nextWidth, options), rows.data(), nextWidth);
+                filtered = rows.data();
+            }
+
+            next.resize((size_t) nextWidth * nextHeight * 4);
+            if (nextHeight != levelHeight)
+                filterColumns(filtered, nextWidth, computeWeights(levelHeight, nextHeight, options), next.data(), nextHeight);
+            else
+                std::copy(filtered, filtered + next.size(), next.begin());
+
+            level.swap(next);
+            levelWidth = nextWidth;
+            levelHeight = nextHeight;
+
+            size_t count = (size_t) levelWidth * levelHeight;
+            float alphaScale = 1;
+            if (preserveCoverage)
+            {
+                alpha.assign((count + 3) / 4 * 4, 0.0f);
+                for (size_t i = 0; i < count; i++)
+                    alpha[i] = level[i * 4 + 3];
+                alphaScale = findAlphaScale(alpha, count, options.alphaCoverage, coverage);
+            }
+
+            MipLevel& mip = _levels[l];
+            mip.width = levelWidth;
+            mip.height = levelHeight;
+            mip.pixels.resize(count * 4);
+
+            const std::vector<float>& source = level;
+            bool sRGB = options.sRGB;
+            Parallel::forRange(count, GRAIN_PIXELS, [&, alphaScale, sRGB](size_t begin, size_t end) {
+                for (size_t i = begin * 4; i < end * 4; i += 4)
+                {
+                    for (int c = 0; c < 3; c++)
+                        mip.pixels[i + c] = quantize(sRGB ? encodeSRGB(std::max(source[i + c], 0.0f)) : source[i + c]);
+                    mip.pixels[i + 3] = quantize(source[i + 3] * alphaScale);
+                }
+            });
+        }
+    }
+
+    size_t MipChain::getLevelCount() const
+    {
+        return _levels.size();
+    }
+
+    const MipLevel& MipChain::getLevel(size_t level) const
+    {
+        if (level >= _levels.size())
+            throw std::out_of_range("Mip chain has no level " + std::to_string(level));
+
+        return _levels[level];
+    }
+
+    void MipChain::upload(Texture2D& texture) const
+    {
+        if (_levels.empty()) return;
+
+        texture.setStorage(_levels[0].width, _levels[0].height, _sRGB ? GL_SRGB8_ALPHA8 : GL_RGBA8, (uint) _levels.size());
+
+        for (size_t l = 0; l < _levels.size(); l++)
+        {
+            const MipLevel& level = _levels[l];
+            texture.setSubData((uint) l, 0, 0, level.width, level.height, GL_RGBA, GL_UNSIGNED_BYTE, level.pixels.data(), 0, 1);
+        }
+    }
+#ifdef GDT_NAMESPACE
+}
+#endif
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "Texture.h"
+
+#include "OpenGL.h"
+
+#include <cstddef>
+#include <vector>
+
+#ifdef GDT_NAMESPACE
+namespace GDT
+{
+#endif
+    enum class MipFilter
+    {
+        // Averages the pixels each lower level pixel covers, cheap but slightly blurry
+        BOX,
+        // Kaiser windowed sinc, keeps lower levels sharper at the cost of mild ringing
+        KAISER
+    };
+
+    struct MipOptions
+    {
+        MipFilter filter = MipFilter::BOX;
+
+        // Whether the color channels are sRGB encoded, they are then filtered in linear space
+        bool sRGB = false;
+
+        // Alpha test reference whose coverage every level keeps, 0 to filter alpha like the other channels
+        float alphaCoverage = 0;
+
+        // Wraps around the edges for tiling textures, instead of clamping to them
+        bool repeat = false;
+
+        // Number of levels to generate including level 0, 0 for the full chain down to 1x1
+        uint levels = 0;
+    };
+
+    /* One level of a MipChain, with tightly packed RGBA8 pixels */
+    struct MipLevel
+    {
+        uint width;
+        uint height;
+        std::vector<unsigned char> pixels;
+    };
+
+    /**
+     * Generates the mip levels of an RGBA8 image on the CPU, so the result
+     * does not depend on the driver. Every level is filtered from the one
+     * above it in separate horizontal and vertical passes, which run on
+     * several threads and filter whole pixels at once with the SIMD backend.
+     * Images of any size are supported, odd sizes round down like the GL.
+     */
+    class MipChain
+    {
+    public:
+        MipChain();
+
+        /**
+         * Generates the levels of an image, replacing those of an earlier call
+         *
+         * @param pixels  The tightly packed RGBA8 pixels of level 0
+         * @param width   The width of the image
+         * @param height  The height of the image
+         * @param options How to filter the levels
+         */
+        void generate(const unsigned char* pixels, uint width, uint height, const MipOptions& options = MipOptions());
+
+        size_t getLevelCount() const;
+        const MipLevel& getLevel(size_t level) const;
+
+        /**
+         * Allocates immutable storage for all levels in a bound texture and
+         * uploads them, as GL_SRGB8_ALPHA8 if the chain was generated from
+         * sRGB pixels and as GL_RGBA8 otherwise
+         */
+        void upload(Texture2D& texture) const;
+
+    private:
+        std::vector<MipLevel> _levels;
+        bool _sRGB;
+    };
+#ifdef GDT_NAMESPACE
+}
+#endif
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+#ifdef GDT_NAMESPACE
+namespace GDT
+{
+#endif
+    namespace Parallel
+    {
+        /**
+         * Splits the range [0, count) into contiguous chunks of at least
+         * grainSize elements and calls func(begin, end) for each chunk on its
+         * own thread. Small ranges run on the calling thread.
+         *
+         * @param count     The number of elements in the range
+         * @param grainSize The minimum number of elements worth a thread
+         * @param func      Callable taking the (begin, end) of a chunk
+         */
+        template<typename Func>
+        void forRange(size_t count, size_t grainSize, Func func)
+        {
+            if (count < 2 * std::max<size_t>(grainSize, 1))
+            {
+                func(size_t(0), count);
+                return;
+            }
+
+            // Querying the number of cores can read from the file system, only do it once
+            static const size_t hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+            size_t numChunks = std::min(hardwareThreads, count / std::max<size_t>(grainSize, 1));
+
+            if (numChunks <= 1)
+            {
+                func(size_t(0), count);
+                return;
+            }
+
+            size_t chunkSize = (count + numChunks - 1) / numChunks;
+
+            std::vector<std::thread> threads;
+            threads.reserve(numChunks - 1);
+            for (size_t begin = chunkSize; begin < count; begin += chunkSize)
+            {
+                size_t end = std::min(begin + chunkSize, count);
+                threads.emplace_back([=]() { func(begin, end); });
+            }
+
+            // The calling thread processes the first chunk itself
+            func(size_t(0), std::min(chunkSize, count));
+
+            for (std::thread& thread : threads)
+                thread.join();
+        }
+    }
+#ifdef GDT_NAMESPACE
+}
+#endif
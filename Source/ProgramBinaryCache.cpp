@@ -0,0 +1,185 @@
+#include "ProgramBinaryCache.h"
+
+#include "Hash.h"
+
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+#ifdef GDT_NAMESPACE
+namespace GDT
+{
+#endif
+    namespace
+    {
+        const char FILE_MAGIC[4] = { 'G', 'D', 'T', 'B' };
+        const uint32_t FILE_VERSION = 2;
+
+        // Written in front of every binary, the checksum catches files cut short by a crash
+        struct FileHeader
+        {
+            char magic[4];
+            uint32_t version;
+            uint64_t key;
+            uint32_t format;
+            uint32_t size;
+            uint32_t metadataSize;
+            uint32_t reserved;
+            uint64_t checksum;
+        };
+
+        // Numbers the temporary files of a process, so concurrent stores of one key never share one
+        std::atomic<unsigned int> tempCounter(0);
+
+        int getProcessId()
+        {
+#ifdef _WIN32
+            return _getpid();
+#else
+            return (int) getpid();
+#endif
+        }
+
+        uint64_t getString(GLenum name, uint64_t hash)
+        {
+            const GLubyte* string = glGetString(name);
+            return Hash::fnv1a(std::string(string ? (const char*) string : ""), hash);
+        }
+    }
+
+    ProgramBinaryCache::ProgramBinaryCache(std::string directory) :
+        _directory(directory)
+    {
+        if (!_directory.empty() && _directory.back() != '/' && _directory.back() != '\\')
+            _directory += '/';
+    }
+
+    const std::string& ProgramBinaryCache::getDirectory() const
+    {
+        return _directory;
+    }
+
+    bool ProgramBinaryCache::load(uint64_t key, GLenum& format, std::vector<unsigned char>& binary) const
+    {
+        std::vector<unsigned char> metadata;
+        return load(key, format, binary, metadata);
+    }
+
+    bool ProgramBinaryCache::load(uint64_t key, GLenum& format, std::vector<unsigned char>& binary, std::vector<unsigned char>& metadata) const
+    {
+        std::ifstream file(getPath(key), std::ios::binary);
+        if (!file.is_open())
+            return false;
+
+        FileHeader header;
+        if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)))
+            return false;
+
+        if (std::char_traits<char>::compare(header.magic, FILE_MAGIC, 4) != 0 ||
+            header.version != FILE_VERSION || header.key != key)
+            return false;
+
+        // A corrupt header must not make us allocate more than the file holds
+        std::streampos start = file.tellg();
+        file.seekg(0, std::ios::end);
+        std::streamoff remaining = file.tellg() - start;
+        file.seekg(start);
+        if (!file || remaining != (std::streamoff) header.size + header.metadataSize)
+            return false;
+
+        binary.resize(header.size);
+        metadata.resize(header.metadataSize);
+        if (!file.read(reinterpret_cast<char*>(binary.data()), header.size) ||
+            !file.read(reinterpret_cast<char*>(metadata.data()), header.metadataSize))
+            return false;
+
+        uint64_t checksum = Hash::fnv1a(binary.data(), binary.size());
+        if (Hash::fnv1a(metadata.data(), metadata.size(), checksum) != header.checksum)
+            return false;
+
+        format = header.format;
+        return true;
+    }
+
+    bool ProgramBinaryCache::store(uint64_t key, GLenum format, const std::vector<unsigned char>& binary) const
+    {
+        return store(key, format, binary, std::vector<unsigned char>());
+    }
+
+    bool ProgramBinaryCache::store(uint64_t key, GLenum format, const std::vector<unsigned char>& binary, const std::vector<unsigned char>& metadata) const
+    {
+        FileHeader header;
+        std::char_traits<char>::copy(header.magic, FILE_MAGIC, 4);
+        header.version = FILE_VERSION;
+        header.key = key;
+        header.format = format;
+        header.size = (uint32_t) binary.size();
+        header.metadataSize = (uint32_t) metadata.size();
+        header.reserved = 0;
+        header.checksum = Hash::fnv1a(metadata.data(), metadata.size(), Hash::fnv1a(binary.data(), binary.size()));
+
+        // Write to a temporary file first so other processes never read a partial binary
+        std::string path = getPath(key);
+        std::string tempPath = path + "." + std::to_string(getProcessId()) + "." + std::to_string(tempCounter++) + ".tmp";
+        {
+            std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+            if (!file.is_open())
+                return false;
+
+            file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            file.write(reinterpret_cast<const char*>(binary.data()), binary.size());
+            file.write(reinterpret_cast<const char*>(metadata.data()), metadata.size());
+            if (!file)
+            {
+                file.close();
+                std::remove(tempPath.c_str());
+                return false;
+            }
+        }
+
+        // Renaming over an existing file fails on Windows
+        std::remove(path.c_str());
+        if (std::rename(tempPath.c_str(), path.c_str()) != 0)
+        {
+            std::remove(tempPath.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    void ProgramBinaryCache::remove(uint64_t key) const
+    {
+        std::remove(getPath(key).c_str());
+    }
+
+    bool ProgramBinaryCache::isSupported()
+    {
+        GLint numFormats = 0;
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &numFormats);
+        return numFormats > 0;
+    }
+
+    uint64_t ProgramBinaryCache::getDriverHash()
+    {
+        uint64_t hash = Hash::FNV_OFFSET_BASIS;
+        hash = getString(GL_VENDOR, hash);
+        hash = getString(GL_RENDERER, hash);
+        hash = getString(GL_VERSION, hash);
+        return hash;
+    }
+
+    std::string ProgramBinaryCache::getPath(uint64_t key) const
+    {
+        char name[32];
+        snprintf(name, sizeof(name), "%016llx.bin", (unsigned long long) key);
+        return _directory + name;
+    }
+#ifdef GDT_NAMESPACE
+}
+#endif
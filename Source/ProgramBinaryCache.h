@@ -0,0 +1,71 @@
+#pragma once
+
+#include "OpenGL.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#ifdef GDT_NAMESPACE
+namespace GDT
+{
+#endif
+    /**
+     * On-disk store of linked program binaries, so a ShaderProgram given the
+     * cache can skip compiling and linking on later runs. Binaries are only
+     * valid for the driver that produced them, which is part of every key.
+     * Failures to read or write the cache are not errors, the program is
+     * simply built from source instead.
+     */
+    class ProgramBinaryCache
+    {
+    public:
+        /**
+         * Creates a cache storing its binaries in the given directory
+         *
+         * @param directory An existing directory the application may write to
+         */
+        ProgramBinaryCache(std::string directory);
+
+        const std::string& getDirectory() const;
+
+        /**
+         * Reads the binary stored under the given key
+         *
+         * @param key    The key the binary was stored with
+         * @param format Receives the driver specific format of the binary
+         * @param binary Receives the binary
+         * @return true if a complete binary was found
+         */
+        bool load(uint64_t key, GLenum& format, std::vector<unsigned char>& binary) const;
+
+        /* Reads a binary along with the metadata it was stored with, such as its reflection */
+        bool load(uint64_t key, GLenum& format, std::vector<unsigned char>& binary, std::vector<unsigned char>& metadata) const;
+
+        /**
+         * Stores a binary under the given key, replacing any previous one
+         *
+         * @return true if the binary was written
+         */
+        bool store(uint64_t key, GLenum format, const std::vector<unsigned char>& binary) const;
+
+        /* Stores a binary along with metadata that is returned when it is loaded */
+        bool store(uint64_t key, GLenum format, const std::vector<unsigned char>& binary, const std::vector<unsigned char>& metadata) const;
+
+        /* Removes the binary stored under the key, for binaries the driver rejected */
+        void remove(uint64_t key) const;
+
+        /* Whether the current context supports any program binary format */
+        static bool isSupported();
+
+        /* Hash of the vendor, renderer and version strings of the current context */
+        static uint64_t getDriverHash();
+
+    private:
+        std::string getPath(uint64_t key) const;
+
+        std::string _directory;
+    };
+#ifdef GDT_NAMESPACE
+}
+#endif
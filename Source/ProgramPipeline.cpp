@@ -0,0 +1,199 @@
+#include "ProgramPipeline.h"
+
+#include "Hash.h"
+#include "ShaderVariantCache.h"
+
+#ifdef GDT_NAMESPACE
+namespace GDT
+{
+#endif
+    ProgramPipeline::ProgramPipeline() :
+        _isCreated(false),
+        _handle(0)
+    {
+
+    }
+
+    void ProgramPipeline::create()
+    {
+        glGenProgramPipelines(1, &_handle);
+        _isCreated = true;
+    }
+
+    void ProgramPipeline::bind() const
+    {
+        // A program made current with glUseProgram takes precedence over the bound pipeline
+        glUseProgram(0);
+        glBindProgramPipeline(_handle);
+    }
+
+    void ProgramPipeline::release() const
+    {
+        glBindProgramPipeline(0);
+    }
+
+    void ProgramPipeline::destroy()
+    {
+        glDeleteProgramPipelines(1, &_handle);
+        _handle = 0;
+        _isCreated = false;
+    }
+
+    void ProgramPipeline::useStages(const ShaderProgram& program, GLbitfield stages)
+    {
+        glUseProgramStages(_handle, stages & program.getStages(), program.getHandle());
+    }
+
+    void ProgramPipeline::setActiveProgram(const ShaderProgram& program)
+    {
+        glActiveShaderProgram(_handle, program.getHandle());
+    }
+
+    bool ProgramPipeline::validate()
+    {
+        glValidateProgramPipeline(_handle);
+
+        GLint status;
+        glGetProgramPipelineiv(_handle, GL_VALIDATE_STATUS, &status);
+        return status == GL_TRUE;
+    }
+
+    std::string ProgramPipeline::getInfoLog() const
+    {
+        GLint logLength = 0;
+        glGetProgramPipelineiv(_handle, GL_INFO_LOG_LENGTH, &logLength);
+        if (logLength <= 0)
+            return std::string();
+
+        std::vector<GLchar> log(logLength);
+        glGetProgramPipelineInfoLog(_handle, logLength, nullptr, log.data());
+        return std::string(log.data());
+    }
+
+    bool ProgramPipeline::isCreated() const
+    {
+        return _isCreated;
+    }
+
+    GLuint ProgramPipeline::getHandle() const
+    {
+        return _handle;
+    }
+
+    PipelineCache::PipelineCache(const ShaderPreprocessor& preprocessor) :
+        _preprocessor(preprocessor),
+        _binaryCache(nullptr)
+    {
+
+    }
+
+    void PipelineCache::setBinaryCache(ProgramBinaryCache* cache)
+    {
+        _binaryCache = cache;
+    }
+
+    ShaderProgram& PipelineCache::getStage(ShaderType type, const std::string& path, const std::vector<ShaderDefine>& requested)
+    {
+        std::vector<ShaderDefine> defines = ShaderVariantCache::canonicalDefines(requested);
+        uint64_t hash = Hash::fnv1a(path, ShaderVariantCache::hashDefines(defines));
+        hash = Hash::fnv1a(&type, sizeof(type), hash);
+
+        auto range = _stages.equal_range(hash);
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            const Stage& stage = it->second;
+            if (stage.type == type && stage.path == path && ShaderVariantCache::sameDefines(stage.defines, defines))
+                return *stage.program;
+        }
+
+        // Preprocessing may throw, so it happens before there is a program to clean up
+        PreprocessedSource source = _preprocessor.processFile(path, defines);
+
+        std::unique_ptr<ShaderProgram> program(new ShaderProgram());
+        program->create();
+        program->setSeparable(true);
+        program->setBinaryCache(_binaryCache);
+
+        try
+        {
+            program->addShader(type, source);
+        }
+        catch (...)
+        {
+            program->destroy();
+            throw;
+        }
+
+        // A failed build destroys the program itself
+        program->build();
+
+        ShaderProgram& result = *program;
+        _stages.insert(std::make_pair(hash, Stage{ type, path, defines, std::move(program) }));
+        return result;
+    }
+
+    ProgramPipeline& PipelineCache::getPipeline(const std::vector<const ShaderProgram*>& programs)
+    {
+        PipelineKey key;
+        key.reserve(programs.size());
+        for (const ShaderProgram* program : programs)
+            key.push_back(std::make_pair(program, program->getGeneration()));
+
+        auto it = _pipelines.find(key);
+        if (it != _pipelines.end())
+            return *it->second;
+
+        // Pipelines made from an earlier generation of these programs refer to programs that are gone
+        for (auto stale = _pipelines.begin(); stale != _pipelines.end();)
+        {
+            bool outdated = false;
+            for (const auto& entry : stale->first)
+            {
+                for (const auto& current : key)
+                    outdated |= entry.first == current.first && entry.second != current.second;
+            }
+
+            if (outdated)
+            {
+                stale->second->destroy();
+                stale = _pipelines.erase(stale);
+            }
+            else
+            {
+                ++stale;
+            }
+        }
+
+        std::unique_ptr<ProgramPipeline> pipeline(new ProgramPipeline());
+        pipeline->create();
+        for (const ShaderProgram* program : programs)
+            pipeline->useStages(*program);
+
+        ProgramPipeline& result = *pipeline;
+        _pipelines.insert(std::make_pair(std::move(key), std::move(pipeline)));
+        return result;
+    }
+
+    size_t PipelineCache::getStageCount() const
+    {
+        return _stages.size();
+    }
+
+    size_t PipelineCache::getPipelineCount() const
+    {
+        return _pipelines.size();
+    }
+
+    void PipelineCache::clear()
+    {
+        for (auto& pipeline : _pipelines)
+            pipeline.second->destroy();
+        for (auto& stage : _stages)
+            stage.second.program->destroy();
+
+        _pipelines.clear();
+        _stages.clear();
+    }
+#ifdef GDT_NAMESPACE
+}
+#endif
@@ -0,0 +1,121 @@
+#pragma once
+
+#include "OpenGL.h"
+#include "Shader.h"
+#include "ShaderPreprocessor.h"
+
+#include <cstdint>
+#include <map>
+#include <unordered_map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifdef GDT_NAMESPACE
+namespace GDT
+{
+#endif
+    /**
+     * Combines the stages of separable programs without linking them
+     * together. Setters of a ShaderProgram act on the active program of a
+     * bound pipeline, so select the stage with setActiveProgram first.
+     */
+    class ProgramPipeline
+    {
+    public:
+        ProgramPipeline();
+
+        void create();
+        void bind() const;
+        void release() const;
+        void destroy();
+
+        /**
+         * Uses the stages of a separable program in this pipeline
+         *
+         * @param program The program providing the stages
+         * @param stages  GL_*_SHADER_BIT stages to take from it, all of its stages by default
+         */
+        void useStages(const ShaderProgram& program, GLbitfield stages = GL_ALL_SHADER_BITS);
+
+        /* Makes the uniform setters of the program apply while this pipeline is bound */
+        void setActiveProgram(const ShaderProgram& program);
+
+        /* Checks whether the stages can run together in the current GL state, getInfoLog() tells why not */
+        bool validate();
+        std::string getInfoLog() const;
+
+        bool isCreated() const;
+        GLuint getHandle() const;
+
+    private:
+        bool _isCreated;
+        GLuint _handle;
+    };
+
+    /**
+     * Builds every shader file with a set of defines once as a separable
+     * single stage program, and every combination of stages once as a
+     * pipeline. N vertex and M fragment shaders take N + M links instead of
+     * N x M.
+     */
+    class PipelineCache
+    {
+    public:
+        /**
+         * @param preprocessor The preprocessor loading the shader files, which has to outlive the cache
+         */
+        PipelineCache(const ShaderPreprocessor& preprocessor);
+
+        /* Binary cache passed on to the stage programs, or nullptr */
+        void setBinaryCache(ProgramBinaryCache* cache);
+
+        /**
+         * Returns the separable program of one shader stage, building it on
+         * the first request. Throws a ShaderLoadingException if it fails.
+         *
+         * @param type    The stage of the shader
+         * @param path    The path of the shader file
+         * @param defines Defines injected into the shader
+         * @return the program, valid until clear() is called
+         */
+        ShaderProgram& getStage(ShaderType type, const std::string& path, const std::vector<ShaderDefine>& defines = {});
+
+        /**
+         * Returns the pipeline combining the given stage programs, creating
+         * it on the first request. Later programs override the stages of
+         * earlier ones. Programs that were rebuilt since get a new pipeline.
+         *
+         * @return the pipeline, valid until clear() is called or one of the programs is rebuilt
+         */
+        ProgramPipeline& getPipeline(const std::vector<const ShaderProgram*>& programs);
+
+        size_t getStageCount() const;
+        size_t getPipelineCount() const;
+
+        /* Destroys all stage programs and pipelines */
+        void clear();
+
+    private:
+        struct Stage
+        {
+            ShaderType type;
+            std::string path;
+            // Canonical, see ShaderVariantCache::canonicalDefines
+            std::vector<ShaderDefine> defines;
+            std::unique_ptr<ShaderProgram> program;
+        };
+
+        const ShaderPreprocessor& _preprocessor;
+        ProgramBinaryCache* _binaryCache;
+
+        std::unordered_multimap<uint64_t, Stage> _stages;
+        // Programs of a pipeline along with their generation when it was made
+        typedef std::vector<std::pair<const ShaderProgram*, uint64_t>> PipelineKey;
+
+        std::map<PipelineKey, std::unique_ptr<ProgramPipeline>> _pipelines;
+    };
+#ifdef GDT_NAMESPACE
+}
+#endif
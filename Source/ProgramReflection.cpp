@@ -0,0 +1,198 @@
+#include "ProgramReflection.h"
+
+#include <cstring>
+
+#ifdef GDT_NAMESPACE
+namespace GDT
+{
+#endif
+    namespace
+    {
+        const char FORMAT_MAGIC[4] = { 'G', 'D', 'T', 'R' };
+        const uint32_t FORMAT_VERSION = 2;
+
+        struct FormatHeader
+        {
+            char magic[4];
+            uint32_t version;
+            uint32_t numResources;
+            uint32_t namesSize;
+        };
+
+        const GLenum BLOCK_PROPERTIES[] = { GL_BUFFER_BINDING, GL_BUFFER_DATA_SIZE };
+        const GLenum UNIFORM_PROPERTIES[] = { GL_TYPE, GL_ARRAY_SIZE, GL_LOCATION, GL_OFFSET, GL_BLOCK_INDEX, GL_ARRAY_STRIDE, GL_MATRIX_STRIDE, GL_IS_ROW_MAJOR };
+        const GLenum BUFFER_VARIABLE_PROPERTIES[] = { GL_TYPE, GL_ARRAY_SIZE, GL_OFFSET, GL_BLOCK_INDEX, GL_ARRAY_STRIDE, GL_MATRIX_STRIDE, GL_IS_ROW_MAJOR };
+        const GLenum VARIABLE_PROPERTIES[] = { GL_TYPE, GL_ARRAY_SIZE, GL_LOCATION };
+
+        template<size_t N>
+        GLsizei count(const GLenum (&)[N])
+        {
+            return (GLsizei) N;
+        }
+
+        void setProperty(ProgramResource& resource, GLenum property, GLint value, GLint firstBlock)
+        {
+            switch (property)
+            {
+            case GL_TYPE: resource.type = (GLenum) value; break;
+            case GL_ARRAY_SIZE: resource.arraySize = value; break;
+            case GL_LOCATION: resource.location = value; break;
+            case GL_BUFFER_BINDING: resource.location = value; break;
+            case GL_OFFSET: resource.offset = value; break;
+            case GL_BLOCK_INDEX: resource.blockIndex = value < 0 ? -1 : firstBlock + value; break;
+            case GL_ARRAY_STRIDE: resource.arrayStride = value; break;
+            case GL_MATRIX_STRIDE: resource.matrixStride = value; break;
+            case GL_IS_ROW_MAJOR: resource.rowMajor = value; break;
+            case GL_BUFFER_DATA_SIZE: resource.dataSize = value; break;
+            default: break;
+            }
+        }
+    }
+
+    ProgramReflection::ProgramReflection()
+    {
+
+    }
+
+    void ProgramReflection::reflect(GLuint program)
+    {
+        clear();
+
+        // Blocks go first, so members can refer to them by their index in the table
+        GLint firstUniformBlock = (GLint) _resources.size();
+        reflectInterface(program, GL_UNIFORM_BLOCK, ProgramInterface::UNIFORM_BLOCK, BLOCK_PROPERTIES, count(BLOCK_PROPERTIES), -1);
+
+        GLint firstStorageBlock = (GLint) _resources.size();
+        reflectInterface(program, GL_SHADER_STORAGE_BLOCK, ProgramInterface::SHADER_STORAGE_BLOCK, BLOCK_PROPERTIES, count(BLOCK_PROPERTIES), -1);
+
+        reflectInterface(program, GL_UNIFORM, ProgramInterface::UNIFORM, UNIFORM_PROPERTIES, count(UNIFORM_PROPERTIES), firstUniformBlock);
+        reflectInterface(program, GL_BUFFER_VARIABLE, ProgramInterface::BUFFER_VARIABLE, BUFFER_VARIABLE_PROPERTIES, count(BUFFER_VARIABLE_PROPERTIES), firstStorageBlock);
+        reflectInterface(program, GL_PROGRAM_INPUT, ProgramInterface::INPUT, VARIABLE_PROPERTIES, count(VARIABLE_PROPERTIES), -1);
+        reflectInterface(program, GL_PROGRAM_OUTPUT, ProgramInterface::OUTPUT, VARIABLE_PROPERTIES, count(VARIABLE_PROPERTIES), -1);
+    }
+
+    void ProgramReflection::clear()
+    {
+        _resources.clear();
+        _names.clear();
+    }
+
+    size_t ProgramReflection::size() const
+    {
+        return _resources.size();
+    }
+
+    bool ProgramReflection::empty() const
+    {
+        return _resources.empty();
+    }
+
+    const ProgramResource& ProgramReflection::operator[](size_t index) const
+    {
+        return _resources[index];
+    }
+
+    const std::vector<ProgramResource>& ProgramReflection::getResources() const
+    {
+        return _resources;
+    }
+
+    const char* ProgramReflection::getName(const ProgramResource& resource) const
+    {
+        return _names.c_str() + resource.nameOffset;
+    }
+
+    int ProgramReflection::find(ProgramInterface interface, const char* name) const
+    {
+        for (size_t i = 0; i < _resources.size(); i++)
+        {
+            if (_resources[i].interface == interface && strcmp(getName(_resources[i]), name) == 0)
+                return (int) i;
+        }
+        return -1;
+    }
+
+    void ProgramReflection::serialize(std::vector<unsigned char>& data) const
+    {
+        FormatHeader header;
+        memcpy(header.magic, FORMAT_MAGIC, sizeof(header.magic));
+        header.version = FORMAT_VERSION;
+        header.numResources = (uint32_t) _resources.size();
+        header.namesSize = (uint32_t) _names.size();
+
+        size_t resourcesSize = _resources.size() * sizeof(ProgramResource);
+        size_t start = data.size();
+        data.resize(start + sizeof(header) + resourcesSize + _names.size());
+
+        unsigned char* out = data.data() + start;
+        memcpy(out, &header, sizeof(header));
+        if (resourcesSize > 0)
+            memcpy(out + sizeof(header), _resources.data(), resourcesSize);
+        if (!_names.empty())
+            memcpy(out + sizeof(header) + resourcesSize, _names.data(), _names.size());
+    }
+
+    bool ProgramReflection::deserialize(const unsigned char* data, size_t size)
+    {
+        clear();
+
+        FormatHeader header;
+        if (size < sizeof(header))
+            return false;
+
+        memcpy(&header, data, sizeof(header));
+        if (memcmp(header.magic, FORMAT_MAGIC, sizeof(header.magic)) != 0 || header.version != FORMAT_VERSION)
+            return false;
+
+        size_t resourcesSize = (size_t) header.numResources * sizeof(ProgramResource);
+        if (size != sizeof(header) + resourcesSize + header.namesSize)
+            return false;
+
+        _resources.resize(header.numResources);
+        if (resourcesSize > 0)
+            memcpy(_resources.data(), data + sizeof(header), resourcesSize);
+        _names.assign(reinterpret_cast<const char*>(data) + sizeof(header) + resourcesSize, header.namesSize);
+
+        // Every name has to end within the pool and members have to refer into the table
+        for (const ProgramResource& resource : _resources)
+        {
+            if (resource.nameOffset >= _names.size() || _names.find('\0', resource.nameOffset) == std::string::npos ||
+                resource.interface > ProgramInterface::OUTPUT || resource.blockIndex >= (GLint) _resources.size())
+            {
+                clear();
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void ProgramReflection::reflectInterface(GLuint program, GLenum programInterface, ProgramInterface interface,
+        const GLenum* properties, GLsizei numProperties, GLint firstBlock)
+    {
+        GLint numResources = 0;
+        GLint maxNameLength = 0;
+        glGetProgramInterfaceiv(program, programInterface, GL_ACTIVE_RESOURCES, &numResources);
+        glGetProgramInterfaceiv(program, programInterface, GL_MAX_NAME_LENGTH, &maxNameLength);
+
+        std::vector<GLchar> name(maxNameLength + 1);
+        std::vector<GLint> values(numProperties);
+
+        for (GLint i = 0; i < numResources; i++)
+        {
+            ProgramResource resource = { interface, 0, -1, -1, -1, -1, -1, -1, -1, -1, (uint32_t) _names.size() };
+
+            glGetProgramResourceiv(program, programInterface, i, numProperties, properties, numProperties, nullptr, values.data());
+            for (GLsizei p = 0; p < numProperties; p++)
+                setProperty(resource, properties[p], values[p], firstBlock);
+
+            GLsizei length = 0;
+            glGetProgramResourceName(program, programInterface, i, (GLsizei) name.size(), &length, name.data());
+            _names.append(name.data(), length);
+            _names.push_back('\0');
+
+            _resources.push_back(resource);
+        }
+    }
+#ifdef GDT_NAMESPACE
+}
+#endif
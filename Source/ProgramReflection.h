@@ -0,0 +1,100 @@
+#pragma once
+
+#include "OpenGL.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#ifdef GDT_NAMESPACE
+namespace GDT
+{
+#endif
+    enum class ProgramInterface : uint32_t
+    {
+        UNIFORM,
+        UNIFORM_BLOCK,
+        SHADER_STORAGE_BLOCK,
+        BUFFER_VARIABLE,
+        INPUT,
+        OUTPUT
+    };
+
+    /**
+     * Active resource of a linked program. Fields that do not apply to the
+     * interface of the resource are -1, or 0 for type.
+     */
+    struct ProgramResource
+    {
+        ProgramInterface interface;
+        GLenum type;
+        GLint arraySize;
+        // Location of uniforms, inputs and outputs, binding point of blocks
+        GLint location;
+        // Offset of block members in their buffer
+        GLint offset;
+        // Index in the table of the block a member belongs to
+        GLint blockIndex;
+        GLint arrayStride;
+        GLint matrixStride;
+        // 1 for block members that are row major matrices, 0 for other uniforms and buffer variables
+        GLint rowMajor;
+        // Minimum buffer size of blocks
+        GLint dataSize;
+        uint32_t nameOffset;
+    };
+
+    /**
+     * Flat table of the uniforms, blocks, block members, inputs and outputs
+     * of a linked program, queried once through the program interface API
+     * of GL 4.3. The table holds no pointers, so it can be serialized and
+     * stored along with a program binary.
+     */
+    class ProgramReflection
+    {
+    public:
+        ProgramReflection();
+
+        /* Replaces the table with the resources of a linked program */
+        void reflect(GLuint program);
+        void clear();
+
+        size_t size() const;
+        bool empty() const;
+        const ProgramResource& operator[](size_t index) const;
+        const std::vector<ProgramResource>& getResources() const;
+
+        /* The name of a resource as reported by the GL, arrays end in "[0]" */
+        const char* getName(const ProgramResource& resource) const;
+
+        /**
+         * Finds a resource by name with a linear search, meant for building
+         * bind tables once rather than for lookups every frame
+         *
+         * @param interface The interface the resource belongs to
+         * @param name      The name as reported by the GL
+         * @return the index of the resource in the table, or -1
+         */
+        int find(ProgramInterface interface, const char* name) const;
+
+        /* Appends the table to the given bytes */
+        void serialize(std::vector<unsigned char>& data) const;
+
+        /**
+         * Replaces the table with one written by serialize()
+         *
+         * @return false, leaving the table empty, if the data is not a valid table
+         */
+        bool deserialize(const unsigned char* data, size_t size);
+
+    private:
+        void reflectInterface(GLuint program, GLenum programInterface, ProgramInterface interface,
+            const GLenum* properties, GLsizei numProperties, GLint firstBlock);
+
+        std::vector<ProgramResource> _resources;
+        std::string _names;
+    };
+#ifdef GDT_NAMESPACE
+}
+#endif
@@ -0,0 +1,241 @@
+#include "Quaternionf.h"
+
+#include "Vector3f.h"
+#include "Matrix4f.h"
+#include "Maths.h"
+
+#include <cmath>
+
+#ifdef GDT_NAMESPACE
+namespace GDT
+{
+#endif
+    const Quaternionf Quaternionf::IDENTITY = Quaternionf(0, 0, 0, 1);
+
+    namespace
+    {
+        // Above this cosine the quaternions are close enough for slerp to fall back to nlerp
+        const float SLERP_THRESHOLD = 0.9995f;
+
+        inline Quaternionf nlerpShortest(const Quaternionf& q1, const Quaternionf& q2, float t)
+        {
+            float t2 = dot(q1, q2) < 0 ? -t : t;
+            Quaternionf q = q1 * (1 - t) + q2 * t2;
+            return q.normalize();
+        }
+
+        inline Quaternionf slerpShortest(const Quaternionf& q1, const Quaternionf& q2, float t)
+        {
+            float cosTheta = dot(q1, q2);
+            float sign = 1;
+            if (cosTheta < 0)
+            {
+                cosTheta = -cosTheta;
+                sign = -1;
+            }
+
+            if (cosTheta > SLERP_THRESHOLD)
+                return nlerpShortest(q1, q2, t);
+
+            float theta = acosf(cosTheta);
+            float invSinTheta = 1 / sinf(theta);
+            float w1 = sinf((1 - t) * theta) * invSinTheta;
+            float w2 = sinf(t * theta) * invSinTheta * sign;
+
+            return q1 * w1 + q2 * w2;
+        }
+    }
+
+    Quaternionf::Quaternionf() :
+        x(0), y(0), z(0), w(1)
+    {
+
+    }
+
+    Quaternionf::Quaternionf(float x, float y, float z, float w) :
+        x(x), y(y), z(z), w(w)
+    {
+
+    }
+
+    Quaternionf Quaternionf::fromAxisAngle(float angle, const Vector3f& axis)
+    {
+        float halfAngle = Math::toRadians(angle) * 0.5f;
+        float s = sinf(halfAngle);
+
+        return Quaternionf(axis.x * s, axis.y * s, axis.z * s, cosf(halfAngle));
+    }
+
+    Quaternionf Quaternionf::fromEuler(const Vector3f& euler)
+    {
+        return fromAxisAngle(euler.x, Vector3f(1, 0, 0)) *
+            fromAxisAngle(euler.y, Vector3f(0, 1, 0)) *
+            fromAxisAngle(euler.z, Vector3f(0, 0, 1));
+    }
+
+    void Quaternionf::set(float x, float y, float z, float w)
+    {
+        this->x = x;
+        this->y = y;
+        this->z = z;
+        this->w = w;
+    }
+
+    void Quaternionf::set(const Quaternionf& q)
+    {
+        set(q.x, q.y, q.z, q.w);
+    }
+
+    Quaternionf& Quaternionf::normalize()
+    {
+        float il = 1 / length();
+
+        x *= il;
+        y *= il;
+        z *= il;
+        w *= il;
+        return *this;
+    }
+
+    float Quaternionf::sqrMagnitude() const
+    {
+        return x * x + y * y + z * z + w * w;
+    }
+
+    float Quaternionf::length() const
+    {
+        return sqrt(sqrMagnitude());
+    }
+
+    Vector3f Quaternionf::rotate(const Vector3f& v) const
+    {
+        Vector3f u(x, y, z);
+        Vector3f t = cross(u, v) * 2;
+        return v + t * w + cross(u, t);
+    }
+
+    Matrix4f Quaternionf::toMatrix() const
+    {
+        return compose(Vector3f(0), *this, Vector3f(1));
+    }
+
+    /* Operator overloads */
+    bool Quaternionf::operator==(const Quaternionf& q) const
+    {
+        return x == q.x && y == q.y && z == q.z && w == q.w;
+    }
+
+    bool Quaternionf::operator!=(const Quaternionf& q) const
+    {
+        return x != q.x || y != q.y || z != q.z || w != q.w;
+    }
+
+    Quaternionf& Quaternionf::operator*=(const Quaternionf& q)
+    {
+        set(*this * q);
+        return *this;
+    }
+
+    Quaternionf Quaternionf::operator*(const Quaternionf& q) const
+    {
+        return Quaternionf(
+            w * q.x + x * q.w + y * q.z - z * q.y,
+            w * q.y - x * q.z + y * q.w + z * q.x,
+            w * q.z + x * q.y - y * q.x + z * q.w,
+            w * q.w - x * q.x - y * q.y - z * q.z);
+    }
+
+    Quaternionf Quaternionf::operator*(const float f) const
+    {
+        return Quaternionf(x * f, y * f, z * f, w * f);
+    }
+
+    Quaternionf Quaternionf::operator+(const Quaternionf& q) const
+    {
+        return Quaternionf(x + q.x, y + q.y, z + q.z, w + q.w);
+    }
+
+    Quaternionf Quaternionf::operator-() const
+    {
+        return Quaternionf(-x, -y, -z, -w);
+    }
+
+    float dot(const Quaternionf& q1, const Quaternionf& q2)
+    {
+        return q1.x * q2.x + q1.y * q2.y + q1.z * q2.z + q1.w * q2.w;
+    }
+
+    Quaternionf normalize(const Quaternionf& q)
+    {
+        Quaternionf n = q;
+        return n.normalize();
+    }
+
+    Quaternionf conjugate(const Quaternionf& q)
+    {
+        return Quaternionf(-q.x, -q.y, -q.z, q.w);
+    }
+
+    Quaternionf inverse(const Quaternionf& q)
+    {
+        return conjugate(q) * (1 / q.sqrMagnitude());
+    }
+
+    Quaternionf nlerp(const Quaternionf& q1, const Quaternionf& q2, float t)
+    {
+        return nlerpShortest(q1, q2, t);
+    }
+
+    Quaternionf slerp(const Quaternionf& q1, const Quaternionf& q2, float t)
+    {
+        return slerpShortest(q1, q2, t);
+    }
+
+    void nlerp(const Quaternionf* q1, const Quaternionf* q2, float t, Quaternionf* out, size_t count)
+    {
+        for (size_t i = 0; i < count; i++)
+            out[i] = nlerpShortest(q1[i], q2[i], t);
+    }
+
+    void slerp(const Quaternionf* q1, const Quaternionf* q2, float t, Quaternionf* out, size_t count)
+    {
+        for (size_t i = 0; i < count; i++)
+            out[i] = slerpShortest(q1[i], q2[i], t);
+    }
+
+    Matrix4f compose(const Vector3f& translation, const Quaternionf& rotation, const Vector3f& scale)
+    {
+        const Quaternionf& q = rotation;
+        float x2 = q.x + q.x, y2 = q.y + q.y, z2 = q.z + q.z;
+        float xx = q.x * x2, yy = q.y * y2, zz = q.z * z2;
+        float xy = q.x * y2, xz = q.x * z2, yz = q.y * z2;
+        float wx = q.w * x2, wy = q.w * y2, wz = q.w * z2;
+
+        Matrix4f m;
+        float* d = m.toArray();
+        d[0] = (1 - (yy + zz)) * scale.x;
+        d[1] = (xy + wz) * scale.x;
+        d[2] = (xz - wy) * scale.x;
+
+        d[4] = (xy - wz) * scale.y;
+        d[5] = (1 - (xx + zz)) * scale.y;
+        d[6] = (yz + wx) * scale.y;
+
+        d[8] = (xz + wy) * scale.z;
+        d[9] = (yz - wx) * scale.z;
+        d[10] = (1 - (xx + yy)) * scale.z;
+
+        d[12] = translation.x;
+        d[13] = translation.y;
+        d[14] = translation.z;
+        return m;
+    }
+
+    std::ostream& operator<<(std::ostream& os, const Quaternionf& q)
+    {
+        os << '(' << q.x << ", " << q.y << ", " << q.z << ", " << q.w << ')';
+        return os;
+    }
+#ifdef GDT_NAMESPACE
+}
+#endif
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstddef>
+#include <iostream>
+
+#ifdef GDT_NAMESPACE
+namespace GDT
+{
+#endif
+    class Vector3f;
+    class Matrix4f;
+
+    class Quaternionf
+    {
+    public:
+        const static Quaternionf IDENTITY;
+
+        float x, y, z, w;
+
+        Quaternionf();
+        Quaternionf(float x, float y, float z, float w);
+
+        /**
+         * Creates a rotation around the given axis, matching Matrix4f::rotate
+         *
+         * @param angle The angle in degrees
+         * @param axis  The normalized axis to rotate around
+         */
+        static Quaternionf fromAxisAngle(float angle, const Vector3f& axis);
+
+        /**
+         * Creates the rotation applied by Matrix4f::rotate(const Vector3f& euler),
+         * which rotates around x, then y, then z in the local frame.
+         *
+         * @param euler The angles in degrees around each axis
+         */
+        static Quaternionf fromEuler(const Vector3f& euler);
+
+        void set(float x, float y, float z, float w);
+        void set(const Quaternionf& q);
+        Quaternionf& normalize();
+
+        float sqrMagnitude() const;
+        float length() const;
+
+        Vector3f rotate(const Vector3f& v) const;
+        Matrix4f toMatrix() const;
+
+        /* Operator overloads */
+        bool operator==(const Quaternionf& q) const;
+        bool operator!=(const Quaternionf& q) const;
+
+        Quaternionf& operator*=(const Quaternionf& q);
+        Quaternionf operator*(const Quaternionf& q) const;
+        Quaternionf operator*(const float f) const;
+        Quaternionf operator+(const Quaternionf& q) const;
+        Quaternionf operator-() const;
+    };
+
+    float dot(const Quaternionf& q1, const Quaternionf& q2);
+    Quaternionf normalize(const Quaternionf& q);
+    Quaternionf conjugate(const Quaternionf& q);
+    Quaternionf inverse(const Quaternionf& q);
+
+    /* Interpolation along the shortest path, nlerp is cheaper but does not have constant angular velocity */
+    Quaternionf nlerp(const Quaternionf& q1, const Quaternionf& q2, float t);
+    Quaternionf slerp(const Quaternionf& q1, const Quaternionf& q2, float t);
+
+    /* Batch interpolation of count pairs of quaternions, out may alias either input */
+    void nlerp(const Quaternionf* q1, const Quaternionf* q2, float t, Quaternionf* out, size_t count);
+    void slerp(const Quaternionf* q1, const Quaternionf* q2, float t, Quaternionf* out, size_t count);
+
+    /**
+     * Builds the matrix that scales, then rotates, then translates, equal to
+     * calling translate, rotate and scale on an identity matrix but without
+     * the trigonometry and intermediate matrix products.
+     */
+    Matrix4f compose(const Vector3f& translation, const Quaternionf& rotation, const Vector3f& scale);
+
+    std::ostream& operator<<(std::ostream& os, const Quaternionf& q);
+#ifdef GDT_NAMESPACE
+}
+#endif
@@ -0,0 +1,208 @@
+#include "RingBuffer.h"
+
+#include "Extensions.h"
+
+#include <cstring>
+#include <stdexcept>
+
+#ifdef GDT_NAMESPACE
+namespace GDT
+{
+#endif
+    namespace
+    {
+        const GLbitfield PERSISTENT_MAP_FLAGS = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+        // Timeout of a single wait for a fence, after which the wait is retried
+        const GLuint64 FENCE_TIMEOUT = 1000000000;
+
+        size_t alignUp(size_t offset, size_t alignment)
+        {
+            return (offset + alignment - 1) / alignment * alignment;
+        }
+    }
+
+    RingBuffer::RingBuffer(GLenum target) :
+        _target(target),
+        _handle(0),
+        _isCreated(false),
+        _isPersistent(false),
+        _mapped(nullptr),
+        _frameSize(0),
+        _alignment(1),
+        _framesInFlight(0),
+        _frame(0),
+        _head(0),
+        _waitCount(0)
+    {
+
+    }
+
+    void RingBuffer::create(size_t frameSize, unsigned int framesInFlight)
+    {
+        if (_isCreated)
+            destroy();
+
+        GLint alignment = 0;
+        if (_target == GL_UNIFORM_BUFFER)
+            glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+        else if (_target == GL_SHADER_STORAGE_BUFFER)
+            glGetIntegerv(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &alignment);
+
+        _alignment = alignment > 0 ? (size_t) alignment : 1;
+        _frameSize = alignUp(frameSize, _alignment);
+        _framesInFlight = framesInFlight > 0 ? framesInFlight : 1;
+        _frame = 0;
+        _head = 0;
+        _waitCount = 0;
+        _fences.assign(_framesInFlight, nullptr);
+
+        size_t totalSize = _frameSize * _framesInFlight;
+
+        glGenBuffers(1, &_handle);
+        glBindBuffer(_target, _handle);
+
+        _isPersistent = Extensions::hasBufferStorage();
+        if (_isPersistent)
+        {
+            Extensions::glBufferStorage(_target, totalSize, nullptr, PERSISTENT_MAP_FLAGS);
+            _mapped = static_cast<unsigned char*>(glMapBufferRange(_target, 0, totalSize, PERSISTENT_MAP_FLAGS));
+            _isPersistent = _mapped != nullptr;
+        }
+
+        if (!_isPersistent)
+        {
+            glBufferData(_target, totalSize, nullptr, GL_STREAM_DRAW);
+            _staging.resize(_frameSize);
+        }
+
+        _isCreated = true;
+    }
+
+    void RingBuffer::destroy()
+    {
+        if (!_isCreated) return;
+
+        for (GLsync& fence : _fences)
+        {
+            if (fence)
+                glDeleteSync(fence);
+            fence = nullptr;
+        }
+
+        if (_mapped)
+        {
+            glBindBuffer(_target, _handle);
+            glUnmapBuffer(_target);
+            _mapped = nullptr;
+        }
+
+        glDeleteBuffers(1, &_handle);
+        _handle = 0;
+        _staging.clear();
+        _isCreated = false;
+        _isPersistent = false;
+    }
+
+    RingBuffer::Allocation RingBuffer::allocate(size_t size)
+    {
+        size_t offset = alignUp(_head, _alignment);
+        if (offset + size > _frameSize)
+            throw std::out_of_range("Ring buffer frame is full, create it with a larger frame size");
+
+        _head = offset + size;
+
+        size_t frameStart = _frame * _frameSize;
+        unsigned char* data = _isPersistent ? _mapped + frameStart + offset : _staging.data() + offset;
+
+        return Allocation{ data, frameStart + offset, size };
+    }
+
+    void RingBuffer::bindRange(GLuint index, const Allocation& allocation)
+    {
+        upload(allocation);
+        glBindBufferRange(_target, index, _handle, allocation.offset, allocation.size);
+    }
+
+    void RingBuffer::endFrame()
+    {
+        if (_fences[_frame])
+            glDeleteSync(_fences[_frame]);
+        _fences[_frame] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+        _frame = (_frame + 1) % _framesInFlight;
+        _head = 0;
+
+        waitForFrame(_frame);
+    }
+
+    bool RingBuffer::isCreated() const
+    {
+        return _isCreated;
+    }
+
+    bool RingBuffer::isPersistent() const
+    {
+        return _isPersistent;
+    }
+
+    GLuint RingBuffer::getHandle() const
+    {
+        return _handle;
+    }
+
+    size_t RingBuffer::getFrameSize() const
+    {
+        return _frameSize;
+    }
+
+    size_t RingBuffer::getUsedSize() const
+    {
+        return _head;
+    }
+
+    size_t RingBuffer::getWaitCount() const
+    {
+        return _waitCount;
+    }
+
+    // Copies a staged allocation into the buffer, only its own range so later allocations can still be written
+    void RingBuffer::upload(const Allocation& allocation)
+    {
+        if (_isPersistent || allocation.size == 0)
+            return;
+
+        // The fence of this region has been waited for, so the GPU is not reading it
+        glBindBuffer(_target, _handle);
+        void* data = glMapBufferRange(_target, allocation.offset, allocation.size,
+            GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_INVALIDATE_RANGE_BIT);
+
+        if (data)
+        {
+            memcpy(data, _staging.data() + (allocation.offset - _frame * _frameSize), allocation.size);
+            glUnmapBuffer(_target);
+        }
+    }
+
+    void RingBuffer::waitForFrame(unsigned int frame)
+    {
+        GLsync fence = _fences[frame];
+        if (!fence)
+            return;
+
+        GLenum result = glClientWaitSync(fence, 0, 0);
+        if (result == GL_TIMEOUT_EXPIRED)
+        {
+            _waitCount++;
+            do
+            {
+                result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, FENCE_TIMEOUT);
+            } while (result == GL_TIMEOUT_EXPIRED);
+        }
+
+        glDeleteSync(fence);
+        _fences[frame] = nullptr;
+    }
+#ifdef GDT_NAMESPACE
+}
+#endif
@@ -0,0 +1,108 @@
+#pragma once
+
+#include "OpenGL.h"
+
+#include <cstddef>
+#include <vector>
+
+#ifdef GDT_NAMESPACE
+namespace GDT
+{
+#endif
+    /**
+     * Buffer for data that changes every draw, such as per-draw uniform
+     * blocks. It is split into one region per frame in flight and each
+     * frame hands out ranges of its region, which are written with plain
+     * memory copies and bound with glBindBufferRange. A fence guards every
+     * region, so it is only reused once the GPU finished the frame that
+     * read from it.
+     *
+     * With GL 4.4 or GL_ARB_buffer_storage the buffer is mapped once,
+     * persistently. Otherwise allocations are staged in memory and each
+     * one is copied through an unsynchronized map when it is bound, which
+     * the fences make safe. Either way, write an allocation before binding
+     * it, and bind it again after writing it again.
+     */
+    class RingBuffer
+    {
+    public:
+        struct Allocation
+        {
+            // Where to write the data, valid until the end of the frame
+            void* data;
+            // Offset of the allocation in the buffer, aligned for bindRange
+            size_t offset;
+            size_t size;
+        };
+
+        /**
+         * @param target The buffer target, GL_UNIFORM_BUFFER or GL_SHADER_STORAGE_BUFFER
+         */
+        RingBuffer(GLenum target);
+
+        /**
+         * Creates the buffer
+         *
+         * @param frameSize      Bytes available for allocations in one frame
+         * @param framesInFlight Number of frames the GPU may lag behind
+         */
+        void create(size_t frameSize, unsigned int framesInFlight = 3);
+        void destroy();
+
+        /**
+         * Allocates a range of the current frame's region. Throws a
+         * std::out_of_range if the region has no room left.
+         *
+         * @param size The size of the range in bytes
+         * @return the allocation to write the data to
+         */
+        Allocation allocate(size_t size);
+
+        /* Binds an allocation of the current frame to an indexed binding point, its data has to be written by now */
+        void bindRange(GLuint index, const Allocation& allocation);
+
+        /**
+         * Fences the current frame's region and moves to the next one,
+         * waiting for the GPU if it has not finished with it yet
+         */
+        void endFrame();
+
+        bool isCreated() const;
+
+        /* Whether the buffer is persistently mapped */
+        bool isPersistent() const;
+
+        GLuint getHandle() const;
+        size_t getFrameSize() const;
+
+        /* Bytes allocated in the current frame, including alignment */
+        size_t getUsedSize() const;
+
+        /* Number of times endFrame had to wait for the GPU, a sign of too few frames in flight */
+        size_t getWaitCount() const;
+
+    private:
+        void upload(const Allocation& allocation);
+        void waitForFrame(unsigned int frame);
+
+        GLenum _target;
+        GLuint _handle;
+        bool _isCreated;
+        bool _isPersistent;
+
+        unsigned char* _mapped;
+        std::vector<unsigned char> _staging;
+
+        size_t _frameSize;
+        size_t _alignment;
+        unsigned int _framesInFlight;
+        unsigned int _frame;
+
+        size_t _head;
+
+        std::vector<GLsync> _fences;
+        size_t _waitCount;
+    };
+#ifdef GDT_NAMESPACE
+}
+#endif
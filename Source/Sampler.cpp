@@ -0,0 +1,217 @@
+#include "Sampler.h"
+
+#include "Extensions.h"
+#include "Hash.h"
+
+#include <algorithm>
+
+#ifdef GDT_NAMESPACE
+namespace GDT
+{
+#endif
+    namespace
+    {
+        // Binding of a unit that has to be made regardless, because the state of the GL is not known
+        const GLuint UNKNOWN = 0xFFFFFFFF;
+
+        GLint getMinFilter(Sampling minFilter, Sampling mipFilter)
+        {
+            switch (mipFilter)
+            {
+            case NEAREST: return minFilter == NEAREST ? GL_NEAREST_MIPMAP_NEAREST : GL_LINEAR_MIPMAP_NEAREST;
+            case LINEAR:  return minFilter == NEAREST ? GL_NEAREST_MIPMAP_LINEAR : GL_LINEAR_MIPMAP_LINEAR;
+            default:      return minFilter == NEAREST ? GL_NEAREST : GL_LINEAR;
+            }
+        }
+    }
+
+    bool SamplerDescription::operator==(const SamplerDescription& d) const
+    {
+        return minFilter == d.minFilter && magFilter == d.magFilter && mipFilter == d.mipFilter
+            && wrapS == d.wrapS && wrapT == d.wrapT && wrapR == d.wrapR
+            && maxAnisotropy == d.maxAnisotropy
+            && minLod == d.minLod && maxLod == d.maxLod && lodBias == d.lodBias
+            && compareFunc == d.compareFunc
+            && std::equal(borderColor, borderColor + 4, d.borderColor);
+    }
+
+    bool SamplerDescription::operator!=(const SamplerDescription& d) const
+    {
+        return !(*this == d);
+    }
+
+    uint64_t SamplerDescription::hash() const
+    {
+        // Field by field, so padding between them does not end up in the hash
+        int filters[6] = { minFilter, magFilter, mipFilter, wrapS, wrapT, wrapR };
+        float values[4] = { maxAnisotropy, minLod, maxLod, lodBias };
+
+        uint64_t hash = Hash::fnv1a(filters, sizeof(filters));
+        hash = Hash::fnv1a(values, sizeof(values), hash);
+        hash = Hash::fnv1a(&compareFunc, sizeof(compareFunc), hash);
+        return Hash::fnv1a(borderColor, sizeof(borderColor), hash);
+    }
+
+    Sampler::Sampler() :
+        _isCreated(false),
+        _handle(0)
+    {
+
+    }
+
+    void Sampler::create()
+    {
+        glGenSamplers(1, &_handle);
+
+        _isCreated = true;
+    }
+
+    void Sampler::destroy()
+    {
+        if (!_isCreated) return;
+
+        glDeleteSamplers(1, &_handle);
+
+        _isCreated = false;
+    }
+
+    void Sampler::setDescription(const SamplerDescription& description)
+    {
+        if (!_isCreated) return;
+
+        _description = description;
+
+        glSamplerParameteri(_handle, GL_TEXTURE_MIN_FILTER, getMinFilter(description.minFilter, description.mipFilter));
+        glSamplerParameteri(_handle, GL_TEXTURE_MAG_FILTER, description.magFilter == NEAREST ? GL_NEAREST : GL_LINEAR);
+
+        glSamplerParameteri(_handle, GL_TEXTURE_WRAP_S, description.wrapS);
+        glSamplerParameteri(_handle, GL_TEXTURE_WRAP_T, description.wrapT);
+        glSamplerParameteri(_handle, GL_TEXTURE_WRAP_R, description.wrapR);
+
+        if (Extensions::hasAnisotropicFiltering())
+            glSamplerParameterf(_handle, GL_TEXTURE_MAX_ANISOTROPY, std::max(description.maxAnisotropy, 1.0f));
+
+        glSamplerParameterf(_handle, GL_TEXTURE_MIN_LOD, description.minLod);
+        glSamplerParameterf(_handle, GL_TEXTURE_MAX_LOD, description.maxLod);
+        glSamplerParameterf(_handle, GL_TEXTURE_LOD_BIAS, description.lodBias);
+
+        if (description.compareFunc != GL_NONE)
+        {
+            glSamplerParameteri(_handle, GL_TEXTURE_COMPARE_MODE, GL_COMPARE_REF_TO_TEXTURE);
+            glSamplerParameteri(_handle, GL_TEXTURE_COMPARE_FUNC, description.compareFunc);
+        }
+        else
+        {
+            glSamplerParameteri(_handle, GL_TEXTURE_COMPARE_MODE, GL_NONE);
+        }
+
+        glSamplerParameterfv(_handle, GL_TEXTURE_BORDER_COLOR, description.borderColor);
+    }
+
+    const SamplerDescription& Sampler::getDescription() const
+    {
+        return _description;
+    }
+
+    void Sampler::bind(TextureUnit textureUnit) const
+    {
+        if (!_isCreated) return;
+
+        glBindSampler(textureUnit, _handle);
+    }
+
+    void Sampler::release(TextureUnit textureUnit) const
+    {
+        glBindSampler(textureUnit, 0);
+    }
+
+    bool Sampler::isCreated() const
+    {
+        return _isCreated;
+    }
+
+    GLuint Sampler::getHandle() const
+    {
+        return _handle;
+    }
+
+    SamplerCache::SamplerCache()
+    {
+
+    }
+
+    const Sampler& SamplerCache::get(const SamplerDescription& description)
+    {
+        uint64_t hash = description.hash();
+
+        auto range = _samplers.equal_range(hash);
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            if (it->second->getDescription() == description)
+                return *it->second;
+        }
+
+        std::unique_ptr<Sampler> sampler(new Sampler());
+        sampler->create();
+        sampler->setDescription(description);
+
+        const Sampler& result = *sampler;
+        _samplers.insert(std::make_pair(hash, std::move(sampler)));
+        return result;
+    }
+
+    void SamplerCache::bind(TextureUnit textureUnit, const SamplerDescription& description)
+    {
+        bind(textureUnit, get(description));
+    }
+
+    void SamplerCache::bind(TextureUnit textureUnit, const Sampler& sampler)
+    {
+        if (!sampler.isCreated()) return;
+
+        bindHandle(textureUnit, sampler.getHandle());
+    }
+
+    void SamplerCache::release(TextureUnit textureUnit)
+    {
+        bindHandle(textureUnit, 0);
+    }
+
+    void SamplerCache::invalidate()
+    {
+        std::fill(_bindings.begin(), _bindings.end(), UNKNOWN);
+    }
+
+    size_t SamplerCache::size() const
+    {
+        return _samplers.size();
+    }
+
+    void SamplerCache::clear()
+    {
+        for (auto& sampler : _samplers)
+        {
+            GLuint handle = sampler.second->getHandle();
+
+            // Deleting a sampler unbinds it from every unit
+            std::replace(_bindings.begin(), _bindings.end(), handle, 0u);
+            sampler.second->destroy();
+        }
+
+        _samplers.clear();
+    }
+
+    void SamplerCache::bindHandle(GLuint unit, GLuint handle)
+    {
+        if (unit >= _bindings.size())
+            _bindings.resize(unit + 1, UNKNOWN);
+
+        if (_bindings[unit] == handle)
+            return;
+
+        glBindSampler(unit, handle);
+        _bindings[unit] = handle;
+    }
+#ifdef GDT_NAMESPACE
+}
+#endif
@@ -0,0 +1,119 @@
+#pragma once
+
+#include "Texture.h"
+
+#include "OpenGL.h"
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#ifdef GDT_NAMESPACE
+namespace GDT
+{
+#endif
+    /**
+     * Complete sampling state of a Sampler, the defaults match those of a
+     * new GL sampler object apart from the filters
+     */
+    struct SamplerDescription
+    {
+        Sampling minFilter = LINEAR;
+        Sampling magFilter = LINEAR;
+        Sampling mipFilter = NONE;
+
+        Wrapping wrapS = REPEAT;
+        Wrapping wrapT = REPEAT;
+        Wrapping wrapR = REPEAT;
+
+        // Values above 1 only take effect with Extensions::hasAnisotropicFiltering()
+        float maxAnisotropy = 1;
+
+        float minLod = -1000;
+        float maxLod = 1000;
+        float lodBias = 0;
+
+        // Depth comparison function such as GL_LEQUAL, or GL_NONE to sample depth textures as values
+        GLenum compareFunc = GL_NONE;
+
+        float borderColor[4] = { 0, 0, 0, 0 };
+
+        bool operator==(const SamplerDescription& d) const;
+        bool operator!=(const SamplerDescription& d) const;
+
+        uint64_t hash() const;
+    };
+
+    /**
+     * GL sampler object, which overrides the sampling parameters of the
+     * texture bound to the same unit. One sampler can serve any number of
+     * textures, so textures sampled in different ways need not be rebound
+     * with new parameters.
+     */
+    class Sampler
+    {
+    public:
+        Sampler();
+        void create();
+        void destroy();
+
+        /* Sets all parameters of the sampler, without needing to bind it */
+        void setDescription(const SamplerDescription& description);
+        const SamplerDescription& getDescription() const;
+
+        void bind(TextureUnit textureUnit) const;
+        void release(TextureUnit textureUnit) const;
+
+        bool isCreated() const;
+        GLuint getHandle() const;
+
+    private:
+        bool _isCreated;
+        GLuint _handle;
+        SamplerDescription _description;
+    };
+
+    /**
+     * Shares one Sampler between all users of the same description, and
+     * skips binding a sampler to a unit it is already bound to. The unit
+     * bindings start out unknown, call invalidate() after binding samplers
+     * outside of the cache.
+     */
+    class SamplerCache
+    {
+    public:
+        SamplerCache();
+
+        /**
+         * Returns the sampler with the given description, creating it on the
+         * first request
+         *
+         * @return the sampler, valid until clear() is called
+         */
+        const Sampler& get(const SamplerDescription& description);
+
+        /* Binds the sampler with the given description to a texture unit */
+        void bind(TextureUnit textureUnit, const SamplerDescription& description);
+        void bind(TextureUnit textureUnit, const Sampler& sampler);
+
+        /* Unbinds the sampler of a texture unit, so the texture's own parameters apply again */
+        void release(TextureUnit textureUnit);
+
+        /* Marks the sampler bindings of all units unknown */
+        void invalidate();
+
+        size_t size() const;
+
+        /* Destroys all samplers */
+        void clear();
+
+    private:
+        void bindHandle(GLuint unit, GLuint handle);
+
+        std::unordered_multimap<uint64_t, std::unique_ptr<Sampler>> _samplers;
+        std::vector<GLuint> _bindings;
+    };
+#ifdef GDT_NAMESPACE
+}
+#endif
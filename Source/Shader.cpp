@@ -1,9 +1,21 @@
 #include "Shader.h"
 
+#include "Extensions.h"
 #include "File.h"
+#include "Hash.h"
+#include "ProgramBinaryCache.h"
+#include "ShaderPreprocessor.h"
+#include "Vector2f.h"
 #include "Vector3f.h"
+#include "Vector4f.h"
+#include "Matrix3f.h"
 #include "Matrix4f.h"
+#include "Affine3x4.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
 #include <sstream>
 
 #ifdef GDT_NAMESPACE
@@ -31,6 +43,42 @@ namespace GDT
         { }
     };
 
+    // The array setters pass arrays of these straight to the GL
+    static_assert(sizeof(Vector2f) == 2 * sizeof(float), "Vector2f arrays must be tightly packed");
+    static_assert(sizeof(Vector3f) == 3 * sizeof(float), "Vector3f arrays must be tightly packed");
+    static_assert(sizeof(Vector4f) == 4 * sizeof(float), "Vector4f arrays must be tightly packed");
+    static_assert(sizeof(Matrix4f) == 16 * sizeof(float), "Matrix4f arrays must be tightly packed");
+
+    namespace
+    {
+        // Shared by all programs, so a generation is never reused even when programs are swapped
+        std::atomic<uint64_t> lastGeneration(0);
+
+        uint64_t nextGeneration()
+        {
+            return ++lastGeneration;
+        }
+
+        // Size in bytes of one element of a uniform of the given type, as passed to glUniform
+        size_t uniformTypeSize(GLenum type)
+        {
+            switch (type)
+            {
+            case GL_FLOAT_VEC2: case GL_INT_VEC2: case GL_UNSIGNED_INT_VEC2: case GL_BOOL_VEC2: return 8;
+            case GL_FLOAT_VEC3: case GL_INT_VEC3: case GL_UNSIGNED_INT_VEC3: case GL_BOOL_VEC3: return 12;
+            case GL_FLOAT_VEC4: case GL_INT_VEC4: case GL_UNSIGNED_INT_VEC4: case GL_BOOL_VEC4: return 16;
+            case GL_FLOAT_MAT2: return 16;
+            case GL_FLOAT_MAT3: return 36;
+            case GL_FLOAT_MAT4: return 64;
+            case GL_FLOAT_MAT2x3: case GL_FLOAT_MAT3x2: return 24;
+            case GL_FLOAT_MAT2x4: case GL_FLOAT_MAT4x2: return 32;
+            case GL_FLOAT_MAT3x4: case GL_FLOAT_MAT4x3: return 48;
+            // Scalars, booleans, samplers and images are set as one 32 bit value
+            default: return 4;
+            }
+        }
+    }
+
     Shader::Shader(ShaderType type) :
         _type(type),
         _isCreated(false),
@@ -48,11 +96,21 @@ namespace GDT
     bool Shader::loadFromSource(const char* source)
     {
         create();
+        _source = source;
+        _sourceFiles.clear();
         glShaderSource(_handle, 1, &source, nullptr);
 
         return true;
     }
 
+    bool Shader::loadFromSource(const PreprocessedSource& source)
+    {
+        loadFromSource(source.source.c_str());
+        _sourceFiles = source.files;
+
+        return true;
+    }
+
     bool Shader::loadFromFile(std::string path)
     {
         std::string source = loadFile(path);
@@ -81,9 +139,18 @@ namespace GDT
     }
 
     void Shader::compile()
+    {
+        beginCompile();
+        checkCompileStatus();
+    }
+
+    void Shader::beginCompile()
     {
         glCompileShader(_handle);
+    }
 
+    void Shader::checkCompileStatus()
+    {
         GLint status;
         glGetShaderiv(_handle, GL_COMPILE_STATUS, &status);
 
@@ -99,8 +166,10 @@ namespace GDT
 
     void Shader::destroy()
     {
+        // Zeroed so destroying again, as ShaderProgram::destroy does after a failed build, deletes nothing
         if (_handle != 0)
             glDeleteShader(_handle);
+        _handle = 0;
 
         _isCreated = false;
         _isCompiled = false;
@@ -124,7 +193,12 @@ namespace GDT
 
         std::vector<GLchar> log(logLength);
         glGetShaderInfoLog(_handle, logLength, nullptr, log.data());
-        return prefix + std::string(log.begin(), log.end());
+        std::string stringLog(log.begin(), log.end());
+
+        if (!_sourceFiles.empty())
+            stringLog = mapSourceFiles(stringLog, _sourceFiles);
+
+        return prefix + stringLog;
     }
 
 
@@ -134,7 +208,15 @@ namespace GDT
         _isCreated(false),
         _isLinked(false),
         _isValidated(false),
-        _handle(0)
+        _isLoadedFromBinary(false),
+        _isBuilding(false),
+        _isSeparable(false),
+        _binaryCache(nullptr),
+        _useBinaryCache(false),
+        _binaryKey(0),
+        _statistics(),
+        _handle(0),
+        _generation(0)
     {
 
     }
@@ -155,6 +237,14 @@ namespace GDT
         attach(shader);
     }
 
+    void ShaderProgram::addShader(ShaderType type, const PreprocessedSource& source)
+    {
+        Shader shader(type);
+        shader.loadFromSource(source);
+
+        attach(shader);
+    }
+
     void ShaderProgram::addShaderFromFile(ShaderType type, std::string path)
     {
         Shader shader(type);
@@ -172,20 +262,106 @@ namespace GDT
     }
 
     void ShaderProgram::build()
+    {
+        buildAsync();
+
+        if (_isBuilding)
+            finishBuild();
+    }
+
+    void ShaderProgram::buildAsync()
     {
         if (!_isCreated)
             return;
 
+        _isLoadedFromBinary = false;
+        _isBuilding = false;
+        _reflection.clear();
+
         try
         {
-            for (Shader& shader : _attachedShaders)
-                shader.compile();
+            _useBinaryCache = _binaryCache != nullptr && ProgramBinaryCache::isSupported();
+            _binaryKey = _useBinaryCache ? getBinaryKey() : 0;
+
+            if (_useBinaryCache && loadBinary(_binaryKey))
+            {
+                _isLoadedFromBinary = true;
+            }
+            else
+            {
+                // No status is queried here, that would wait for the driver to finish compiling
+                for (Shader& shader : _attachedShaders)
+                    shader.beginCompile();
+
+                if (_useBinaryCache)
+                    glProgramParameteri(_handle, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+
+                if (_isSeparable)
+                    glProgramParameteri(_handle, GL_PROGRAM_SEPARABLE, GL_TRUE);
+
+                glLinkProgram(_handle);
+            }
+
+            _isBuilding = true;
+        }
+        catch (ErrorMessageException& e)
+        {
+            destroy();
+            throw ShaderLoadingException(e);
+        }
+    }
+
+    bool ShaderProgram::poll()
+    {
+        if (!_isBuilding)
+            return _isLinked;
+
+        if (!_isLoadedFromBinary && Extensions::hasParallelShaderCompile())
+        {
+            GLint completed = GL_FALSE;
+            glGetProgramiv(_handle, GL_COMPLETION_STATUS_KHR, &completed);
+
+            if (completed != GL_TRUE)
+                return false;
+        }
+
+        finishBuild();
+        return _isLinked;
+    }
+
+    bool ShaderProgram::isBuilding() const
+    {
+        return _isBuilding;
+    }
+
+    void ShaderProgram::finishBuild()
+    {
+        _isBuilding = false;
+
+        try
+        {
+            if (!_isLoadedFromBinary)
+            {
+                for (Shader& shader : _attachedShaders)
+                    shader.checkCompileStatus();
+
+                checkLinkStatus();
+            }
 
-            link();
             validate();
 
+            // A binary from the cache comes with its reflection, unless it was stored without
+            if (!_isLoadedFromBinary || _reflection.empty())
+                _reflection.reflect(_handle);
+            reflectUniforms();
+
+            if (!_isLoadedFromBinary && _useBinaryCache)
+                storeBinary(_binaryKey);
+
             for (Shader& shader : _attachedShaders)
                 shader.destroy();
+
+            _generation = nextGeneration();
         }
         catch (ErrorMessageException& e)
         {
@@ -194,11 +370,36 @@ namespace GDT
         }
     }
 
+    void ShaderProgram::setBinaryCache(ProgramBinaryCache* cache)
+    {
+        _binaryCache = cache;
+    }
+
+    ProgramBinaryCache* ShaderProgram::getBinaryCache() const
+    {
+        return _binaryCache;
+    }
+
+    void ShaderProgram::setSeparable(bool separable)
+    {
+        _isSeparable = separable;
+    }
+
+    bool ShaderProgram::isSeparable() const
+    {
+        return _isSeparable;
+    }
+
     bool ShaderProgram::isLinked()
     {
         return _isLinked;
     }
 
+    bool ShaderProgram::isLoadedFromBinary() const
+    {
+        return _isLoadedFromBinary;
+    }
+
     bool ShaderProgram::isValidated()
     {
         return _isValidated;
@@ -223,11 +424,44 @@ namespace GDT
             destroy();
 
         _handle = glCreateProgram();
+        _generation = nextGeneration();
 
         _isCreated = true;
         _isLinked = false;
         _isValidated = false;
+        _isBuilding = false;
         _attachedShaders.clear();
+        _reflection.clear();
+        _uniforms.clear();
+        _uniformNames.clear();
+        _shadows.clear();
+        _shadowData.clear();
+    }
+
+    GLuint ShaderProgram::getHandle() const
+    {
+        return _handle;
+    }
+
+    uint64_t ShaderProgram::getGeneration() const
+    {
+        return _generation;
+    }
+
+    GLbitfield ShaderProgram::getStages() const
+    {
+        GLbitfield stages = 0;
+        for (const Shader& shader : _attachedShaders)
+        {
+            switch (shader._type)
+            {
+            case ShaderType::VERTEX: stages |= GL_VERTEX_SHADER_BIT; break;
+            case ShaderType::GEOMETRY: stages |= GL_GEOMETRY_SHADER_BIT; break;
+            case ShaderType::FRAGMENT: stages |= GL_FRAGMENT_SHADER_BIT; break;
+            case ShaderType::COMPUTE: stages |= GL_COMPUTE_SHADER_BIT; break;
+            }
+        }
+        return stages;
     }
 
     void ShaderProgram::bind()
@@ -254,16 +488,84 @@ namespace GDT
             glDeleteProgram(_handle);
             _handle = 0;
         }
+        _generation = nextGeneration();
 
         _isCreated = false;
         _isLinked = false;
         _isValidated = false;
+        _isBuilding = false;
+        _reflection.clear();
+        _uniforms.clear();
+        _uniformNames.clear();
+        _shadows.clear();
+        _shadowData.clear();
     }
 
-    void ShaderProgram::link()
+    UniformHandle ShaderProgram::getUniform(const char* name)
     {
-        glLinkProgram(_handle);
+        std::vector<UniformName>::iterator it = std::lower_bound(_uniformNames.begin(), _uniformNames.end(), name,
+            [](const UniformName& uniform, const char* name) { return strcmp(uniform.name.c_str(), name) < 0; });
+
+        if (it != _uniformNames.end() && strcmp(it->name.c_str(), name) == 0)
+            return it->handle;
+
+        // Names the reflection does not list, like later array elements, are queried once and kept
+        UniformHandle handle = { glGetUniformLocation(_handle, name), -1, 0 };
 
+        // Elements of an array share its shadow, at the offset of the element
+        const char* bracket = strrchr(name, '[');
+        if (handle.location >= 0 && bracket && bracket != name)
+        {
+            char* end;
+            unsigned long element = strtoul(bracket + 1, &end, 10);
+            std::string base(name, bracket);
+
+            std::vector<UniformName>::const_iterator array = std::lower_bound(_uniformNames.begin(), _uniformNames.end(), base,
+                [](const UniformName& uniform, const std::string& name) { return uniform.name < name; });
+
+            if (end != bracket + 1 && strcmp(end, "]") == 0 && array != _uniformNames.end() && array->name == base && array->handle.index >= 0)
+            {
+                const UniformInfo& info = _uniforms[array->handle.index];
+                if (element < (unsigned long) info.size)
+                {
+                    handle.index = array->handle.index;
+                    handle.offset = element * uniformTypeSize(info.type);
+                }
+            }
+        }
+
+        _uniformNames.insert(it, UniformName{ name, handle });
+        return handle;
+    }
+
+    const std::vector<UniformInfo>& ShaderProgram::getActiveUniforms() const
+    {
+        return _uniforms;
+    }
+
+    const ProgramReflection& ShaderProgram::getReflection() const
+    {
+        return _reflection;
+    }
+
+    void ShaderProgram::invalidateUniforms()
+    {
+        for (UniformShadow& shadow : _shadows)
+            shadow.knownSize = 0;
+    }
+
+    const UniformStatistics& ShaderProgram::getUniformStatistics() const
+    {
+        return _statistics;
+    }
+
+    void ShaderProgram::resetUniformStatistics()
+    {
+        _statistics = UniformStatistics();
+    }
+
+    void ShaderProgram::checkLinkStatus()
+    {
         GLint status = 0;
         glGetProgramiv(_handle, GL_LINK_STATUS, &status);
 
@@ -272,6 +574,60 @@ namespace GDT
         if (!_isLinked) throw ShaderLinkageException(getInfoLog());
     }
 
+    uint64_t ShaderProgram::getBinaryKey() const
+    {
+        uint64_t key = ProgramBinaryCache::getDriverHash();
+        key = Hash::fnv1a(&_isSeparable, sizeof(_isSeparable), key);
+        for (const Shader& shader : _attachedShaders)
+        {
+            int type = (int) shader._type;
+            key = Hash::fnv1a(&type, sizeof(type), key);
+            key = Hash::fnv1a(shader._source, key);
+        }
+        return key;
+    }
+
+    bool ShaderProgram::loadBinary(uint64_t key)
+    {
+        GLenum format = 0;
+        std::vector<unsigned char> binary;
+        std::vector<unsigned char> metadata;
+        if (!_binaryCache->load(key, format, binary, metadata))
+            return false;
+
+        glProgramBinary(_handle, format, binary.data(), (GLsizei) binary.size());
+
+        GLint status = 0;
+        glGetProgramiv(_handle, GL_LINK_STATUS, &status);
+
+        // Drivers reject binaries of older versions, the program is then linked from the shaders again
+        _isLinked = status == GL_TRUE;
+        if (!_isLinked)
+            _binaryCache->remove(key);
+        else if (!metadata.empty())
+            _reflection.deserialize(metadata.data(), metadata.size());
+
+        return _isLinked;
+    }
+
+    void ShaderProgram::storeBinary(uint64_t key)
+    {
+        GLint length = 0;
+        glGetProgramiv(_handle, GL_PROGRAM_BINARY_LENGTH, &length);
+        if (length <= 0)
+            return;
+
+        GLenum format = 0;
+        std::vector<unsigned char> binary(length);
+        glGetProgramBinary(_handle, length, &length, &format, binary.data());
+        binary.resize(length);
+
+        std::vector<unsigned char> metadata;
+        _reflection.serialize(metadata);
+
+        _binaryCache->store(key, format, binary, metadata);
+    }
+
     void ShaderProgram::validate()
     {
         glValidateProgram(_handle);
@@ -308,82 +664,295 @@ namespace GDT
         return stringLog;
     }
 
-    GLint ShaderProgram::getUniformLocation(const char* name)
+    void ShaderProgram::reflectUniforms()
     {
-        std::unordered_map<std::string, int>::const_iterator it = _locationMap.find(std::string(name));
-        if (it != _locationMap.end()) {
-            return it->second;
+        _uniforms.clear();
+        _uniformNames.clear();
+        _shadows.clear();
+
+        for (const ProgramResource& resource : _reflection.getResources())
+        {
+            if (resource.interface != ProgramInterface::UNIFORM)
+                continue;
+
+            std::string name = _reflection.getName(resource);
+            GLint location = resource.location;
+            GLenum type = resource.type;
+            GLint size = resource.arraySize;
+
+            // Members of uniform blocks have no location, they are set through buffers instead
+            if (location < 0)
+                continue;
+
+            // Arrays are reported by their first element, but can be set by the plain name too
+            bool isArray = name.size() > 3 && name.compare(name.size() - 3, 3, "[0]") == 0;
+            if (isArray)
+                name.resize(name.size() - 3);
+
+            UniformHandle handle = { location, (int) _uniforms.size(), 0 };
+            _uniforms.push_back(UniformInfo{ name, location, type, size });
+
+            // Initializers in the shader may give a uniform any value, so nothing is known until the first set
+            size_t offset = _shadows.empty() ? 0 : _shadows.back().offset + _shadows.back().size;
+            _shadows.push_back(UniformShadow{ offset, uniformTypeSize(type) * size, 0 });
+            _uniformNames.push_back(UniformName{ name, handle });
+            if (isArray)
+                _uniformNames.push_back(UniformName{ name + "[0]", handle });
         }
-        else {
-            int location = glGetUniformLocation(_handle, name);
-            _locationMap[std::string(name)] = location;
-            return location;
+
+        std::sort(_uniformNames.begin(), _uniformNames.end(), [](const UniformName& a, const UniformName& b) { return a.name < b.name; });
+
+        _shadowData.assign(_shadows.empty() ? 0 : _shadows.back().offset + _shadows.back().size, 0);
+    }
+
+    bool ShaderProgram::updateShadow(UniformHandle uniform, const void* data, size_t size)
+    {
+        // Uniforms without reflection data are always set
+        if (uniform.index < 0)
+        {
+            _statistics.issued++;
+            return true;
+        }
+
+        UniformShadow& shadow = _shadows[uniform.index];
+
+        // Values running past the end of the uniform are always set, and whatever they overlap becomes unknown
+        if (uniform.offset + size > shadow.size)
+        {
+            shadow.knownSize = std::min(shadow.knownSize, uniform.offset);
+            _statistics.issued++;
+            return true;
         }
+
+        unsigned char* stored = &_shadowData[shadow.offset + uniform.offset];
+
+        if (uniform.offset + size <= shadow.knownSize && memcmp(stored, data, size) == 0)
+        {
+            _statistics.elided++;
+            return false;
+        }
+
+        // The known bytes only grow while they stay contiguous from the start of the uniform
+        memcpy(stored, data, size);
+        if (uniform.offset <= shadow.knownSize)
+            shadow.knownSize = std::max(shadow.knownSize, uniform.offset + size);
+
+        _statistics.issued++;
+        return true;
     }
 
     void ShaderProgram::uniform1i(const char* name, int i)
     {
-        glUniform1i(getUniformLocation(name), i);
+        uniform1i(getUniform(name), i);
     }
 
     void ShaderProgram::uniform1ui(const char* name, unsigned int i)
     {
-        glUniform1ui(getUniformLocation(name), i);
+        uniform1ui(getUniform(name), i);
     }
 
     void ShaderProgram::uniform1iv(const char* name, int count, int* values)
     {
-        glUniform1iv(getUniformLocation(name), count, (GLint*)values);
+        uniform1iv(getUniform(name), count, values);
     }
 
     void ShaderProgram::uniform2i(const char* name, int v0, int v1)
     {
-        glUniform2i(getUniformLocation(name), v0, v1);
+        uniform2i(getUniform(name), v0, v1);
     }
 
     void ShaderProgram::uniform2ui(const char* name, unsigned int v0, unsigned int v1)
     {
-        glUniform2ui(getUniformLocation(name), v0, v1);
+        uniform2ui(getUniform(name), v0, v1);
     }
 
     void ShaderProgram::uniform1f(const char* name, float value)
     {
-        glUniform1f(getUniformLocation(name), value);
+        uniform1f(getUniform(name), value);
     }
 
     void ShaderProgram::uniform1fv(const char* name, int count, float* values)
     {
-        glUniform1fv(getUniformLocation(name), count, (GLfloat*)values);
+        uniform1fv(getUniform(name), count, values);
     }
 
     void ShaderProgram::uniform2f(const char* name, float v0, float v1)
     {
-        glUniform2f(getUniformLocation(name), v0, v1);
+        uniform2f(getUniform(name), v0, v1);
+    }
+
+    void ShaderProgram::uniform2fv(const char* name, int count, const Vector2f* values)
+    {
+        uniform2fv(getUniform(name), count, values);
     }
 
     void ShaderProgram::uniform3f(const char* name, float v0, float v1, float v2)
     {
-        glUniform3f(getUniformLocation(name), v0, v1, v2);
+        uniform3f(getUniform(name), v0, v1, v2);
     }
 
     void ShaderProgram::uniform3f(const char* name, const Vector3f& v)
     {
-        glUniform3f(getUniformLocation(name), v.x, v.y, v.z);
+        uniform3f(getUniform(name), v);
     }
 
     void ShaderProgram::uniform3fv(const char* name, int count, Vector3f* values)
     {
-        glUniform3fv(getUniformLocation(name), count, (GLfloat*)values);
+        uniform3fv(getUniform(name), count, values);
     }
 
     void ShaderProgram::uniform4f(const char* name, float v0, float v1, float v2, float v3)
     {
-        glUniform4f(getUniformLocation(name), v0, v1, v2, v3);
+        uniform4f(getUniform(name), v0, v1, v2, v3);
+    }
+
+    void ShaderProgram::uniform4fv(const char* name, int count, const Vector4f* values)
+    {
+        uniform4fv(getUniform(name), count, values);
+    }
+
+    void ShaderProgram::uniformMatrix3f(const char* name, const Matrix3f& m)
+    {
+        uniformMatrix3f(getUniform(name), m);
     }
 
     void ShaderProgram::uniformMatrix4f(const char* name, const Matrix4f& m)
     {
-        glUniformMatrix4fv(getUniformLocation(name), 1, false, m.toArray());
+        uniformMatrix4f(getUniform(name), m);
+    }
+
+    void ShaderProgram::uniformMatrix4fv(const char* name, int count, const Matrix4f* values)
+    {
+        uniformMatrix4fv(getUniform(name), count, values);
+    }
+
+    void ShaderProgram::uniformMatrix4x3f(const char* name, const Affine3x4& m)
+    {
+        uniformMatrix4x3f(getUniform(name), m);
+    }
+
+    void ShaderProgram::uniformMatrix4x3fv(const char* name, int count, const Affine3x4* values)
+    {
+        uniformMatrix4x3fv(getUniform(name), count, values);
+    }
+
+    void ShaderProgram::uniform1i(UniformHandle uniform, int i)
+    {
+        if (updateShadow(uniform, &i, sizeof(i)))
+            glUniform1i(uniform.location, i);
+    }
+
+    void ShaderProgram::uniform1ui(UniformHandle uniform, unsigned int i)
+    {
+        if (updateShadow(uniform, &i, sizeof(i)))
+            glUniform1ui(uniform.location, i);
+    }
+
+    void ShaderProgram::uniform1iv(UniformHandle uniform, int count, int* values)
+    {
+        if (updateShadow(uniform, values, count * sizeof(int)))
+            glUniform1iv(uniform.location, count, (GLint*)values);
+    }
+
+    void ShaderProgram::uniform2i(UniformHandle uniform, int v0, int v1)
+    {
+        int v[2] = { v0, v1 };
+        if (updateShadow(uniform, v, sizeof(v)))
+            glUniform2i(uniform.location, v0, v1);
+    }
+
+    void ShaderProgram::uniform2ui(UniformHandle uniform, unsigned int v0, unsigned int v1)
+    {
+        unsigned int v[2] = { v0, v1 };
+        if (updateShadow(uniform, v, sizeof(v)))
+            glUniform2ui(uniform.location, v0, v1);
+    }
+
+    void ShaderProgram::uniform1f(UniformHandle uniform, float value)
+    {
+        if (updateShadow(uniform, &value, sizeof(value)))
+            glUniform1f(uniform.location, value);
+    }
+
+    void ShaderProgram::uniform1fv(UniformHandle uniform, int count, float* values)
+    {
+        if (updateShadow(uniform, values, count * sizeof(float)))
+            glUniform1fv(uniform.location, count, (GLfloat*)values);
+    }
+
+    void ShaderProgram::uniform2f(UniformHandle uniform, float v0, float v1)
+    {
+        float v[2] = { v0, v1 };
+        if (updateShadow(uniform, v, sizeof(v)))
+            glUniform2f(uniform.location, v0, v1);
+    }
+
+    void ShaderProgram::uniform2fv(UniformHandle uniform, int count, const Vector2f* values)
+    {
+        if (updateShadow(uniform, values, count * sizeof(Vector2f)))
+            glUniform2fv(uniform.location, count, (const GLfloat*)values);
+    }
+
+    void ShaderProgram::uniform3f(UniformHandle uniform, float v0, float v1, float v2)
+    {
+        float v[3] = { v0, v1, v2 };
+        if (updateShadow(uniform, v, sizeof(v)))
+            glUniform3f(uniform.location, v0, v1, v2);
+    }
+
+    void ShaderProgram::uniform3f(UniformHandle uniform, const Vector3f& v)
+    {
+        uniform3f(uniform, v.x, v.y, v.z);
+    }
+
+    void ShaderProgram::uniform3fv(UniformHandle uniform, int count, Vector3f* values)
+    {
+        if (updateShadow(uniform, values, count * sizeof(Vector3f)))
+            glUniform3fv(uniform.location, count, (GLfloat*)values);
+    }
+
+    void ShaderProgram::uniform4f(UniformHandle uniform, float v0, float v1, float v2, float v3)
+    {
+        float v[4] = { v0, v1, v2, v3 };
+        if (updateShadow(uniform, v, sizeof(v)))
+            glUniform4f(uniform.location, v0, v1, v2, v3);
+    }
+
+    void ShaderProgram::uniform4fv(UniformHandle uniform, int count, const Vector4f* values)
+    {
+        if (updateShadow(uniform, values, count * sizeof(Vector4f)))
+            glUniform4fv(uniform.location, count, (const GLfloat*)values);
+    }
+
+    void ShaderProgram::uniformMatrix3f(UniformHandle uniform, const Matrix3f& m)
+    {
+        if (updateShadow(uniform, m.toArray(), 9 * sizeof(float)))
+            glUniformMatrix3fv(uniform.location, 1, false, m.toArray());
+    }
+
+    void ShaderProgram::uniformMatrix4f(UniformHandle uniform, const Matrix4f& m)
+    {
+        if (updateShadow(uniform, m.toArray(), 16 * sizeof(float)))
+            glUniformMatrix4fv(uniform.location, 1, false, m.toArray());
+    }
+
+    void ShaderProgram::uniformMatrix4fv(UniformHandle uniform, int count, const Matrix4f* values)
+    {
+        if (updateShadow(uniform, values, count * sizeof(Matrix4f)))
+            glUniformMatrix4fv(uniform.location, count, false, (const GLfloat*)values);
+    }
+
+    // Affine3x4 is row-major so it is transposed into the column-major mat4x3
+    void ShaderProgram::uniformMatrix4x3f(UniformHandle uniform, const Affine3x4& m)
+    {
+        if (updateShadow(uniform, m.toArray(), 12 * sizeof(float)))
+            glUniformMatrix4x3fv(uniform.location, 1, true, m.toArray());
+    }
+
+    void ShaderProgram::uniformMatrix4x3fv(UniformHandle uniform, int count, const Affine3x4* values)
+    {
+        if (updateShadow(uniform, values, count * sizeof(Affine3x4)))
+            glUniformMatrix4x3fv(uniform.location, count, true, (const GLfloat*)values);
     }
 #ifdef GDT_NAMESPACE
 }
@@ -2,10 +2,12 @@
 
 #include "Exception.h"
 #include "OpenGL.h"
+#include "ProgramReflection.h"
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <vector>
-#include <unordered_map>
 
 #ifdef GDT_NAMESPACE
 namespace GDT
@@ -16,8 +18,14 @@ namespace GDT
         using ErrorMessageException::ErrorMessageException;
     };
 
+    class ProgramBinaryCache;
+    struct PreprocessedSource;
+    class Vector2f;
     class Vector3f;
+    class Vector4f;
+    class Matrix3f;
     class Matrix4f;
+    class Affine3x4;
 
     enum class ShaderType
     {
@@ -27,6 +35,44 @@ namespace GDT
         COMPUTE
     };
 
+    /**
+     * Uniform of a ShaderProgram resolved ahead of time with
+     * ShaderProgram::getUniform, which the uniform setters accept in place
+     * of a name to skip the lookup. A handle stays valid until the program
+     * is created or built again.
+     */
+    struct UniformHandle
+    {
+        // Location in the program, -1 if no active uniform has the name
+        GLint location;
+        // Index into ShaderProgram::getActiveUniforms, -1 for names resolved outside reflection
+        int index;
+        // Byte offset of an array element like "lights[2]" into the value of the array at index
+        size_t offset;
+    };
+
+    /**
+     * Active uniform of a linked program as reported by the GL, arrays are
+     * listed once with the name of their first element stripped of "[0]"
+     */
+    struct UniformInfo
+    {
+        std::string name;
+        GLint location;
+        GLenum type;
+        GLint size;
+    };
+
+    /**
+     * Counts of the glUniform calls made by the setters of a ShaderProgram
+     * and of the calls skipped because the value was already set
+     */
+    struct UniformStatistics
+    {
+        size_t issued;
+        size_t elided;
+    };
+
     class Shader
     {
         friend class ShaderProgram;
@@ -50,6 +96,15 @@ namespace GDT
 
         bool loadFromSource(const char* source);
 
+        /**
+         * Loads preprocessed shader source, compiler logs of the shader will
+         * name the files the source was put together from
+         *
+         * @param source The output of a ShaderPreprocessor
+         * @return true if the source could be loaded
+         */
+        bool loadFromSource(const PreprocessedSource& source);
+
         /**
          * Loads shader source from the given file path
          *
@@ -72,7 +127,13 @@ namespace GDT
     private:
         void create();
 
+        /* Compile in two steps, so a ShaderProgram can query the status after the driver finished */
+        void beginCompile();
+        void checkCompileStatus();
+
         ShaderType _type;
+        std::string _source;
+        std::vector<std::string> _sourceFiles;
 
         bool _isCreated;
         bool _isCompiled;
@@ -87,17 +148,101 @@ namespace GDT
 
         void addShaderFromSource(ShaderType type, const char* source);
         void addShaderFromFile(ShaderType type, std::string path);
+        void addShader(ShaderType type, const PreprocessedSource& source);
         void build();
+
+        /**
+         * Issues the compiles and link of the program without waiting for
+         * the driver. Call this for a whole batch of programs before polling
+         * any of them, so the driver can compile them in parallel, and keep
+         * rendering with a fallback program until poll() returns true.
+         */
+        void buildAsync();
+
+        /**
+         * Checks on a build started with buildAsync() and finishes it once
+         * the driver is done. Without GL_KHR_parallel_shader_compile the
+         * driver cannot report progress, so the first poll waits for it.
+         * Throws a ShaderLoadingException if the build failed, like build().
+         *
+         * @return true if the program is linked and ready for use
+         */
+        bool poll();
+
+        /* Whether a build started with buildAsync() has not finished yet */
+        bool isBuilding() const;
+
         std::string getError();
 
+        /**
+         * Makes build() look up the linked program in the given cache before
+         * compiling, and store it there after linking. The binary is keyed on
+         * the types and sources of the shaders and on the driver, if the
+         * driver rejects it the program is built from source as usual.
+         *
+         * @param cache The cache to use, or nullptr to always build from source
+         */
+        void setBinaryCache(ProgramBinaryCache* cache);
+        ProgramBinaryCache* getBinaryCache() const;
+
+        /**
+         * Marks the program to be linked as separable, so its stages can be
+         * combined with those of other programs in a ProgramPipeline. Has to
+         * be set before building.
+         */
+        void setSeparable(bool separable);
+        bool isSeparable() const;
+
         bool isLinked();
         bool isValidated();
 
+        /* Whether the last build loaded the program from the binary cache */
+        bool isLoadedFromBinary() const;
+
         void create();
         void bind();
         void release();
         void destroy();
 
+        GLuint getHandle() const;
+
+        /**
+         * Number that changes whenever the program is created, built or
+         * destroyed, and that no other program has had. Caches of objects
+         * made from a program compare it to notice when the program changed.
+         */
+        uint64_t getGeneration() const;
+
+        /* The GL_*_SHADER_BIT stages of the shaders added to the program */
+        GLbitfield getStages() const;
+
+        /**
+         * Resolves a uniform name once, for use with the uniform setters.
+         * Active uniforms are known from the reflection done after linking,
+         * so looking them up neither allocates nor queries the GL.
+         *
+         * @param name The name of the uniform, array elements other than the first may be indexed
+         * @return the handle, with location -1 if the program has no such active uniform
+         */
+        UniformHandle getUniform(const char* name);
+
+        /* Active uniforms of the program as of the last build */
+        const std::vector<UniformInfo>& getActiveUniforms() const;
+
+        /* All active resources of the program as of the last build, restored from the binary cache when loaded from it */
+        const ProgramReflection& getReflection() const;
+
+        /**
+         * The setters keep a copy of the last value of every active uniform
+         * and skip the glUniform call when it is set to the same value again.
+         * Call this after changing uniforms of the program outside of the
+         * setters, so the next set of every uniform goes through.
+         */
+        void invalidateUniforms();
+
+        const UniformStatistics& getUniformStatistics() const;
+        void resetUniformStatistics();
+
         void uniform1i(const char* name, int i);
         void uniform1ui(const char* name, unsigned int i);
         void uniform1iv(const char* name, int count, int* values);
@@ -106,31 +251,101 @@ namespace GDT
         void uniform1f(const char* name, float value);
         void uniform1fv(const char* name, int count, float* values);
         void uniform2f(const char* name, float v0, float v1);
+        void uniform2fv(const char* name, int count, const Vector2f* values);
         void uniform3f(const char* name, float v0, float v1, float v2);
         void uniform3f(const char* name, const Vector3f& v);
         void uniform3fv(const char* name, int count, Vector3f* values);
         void uniform4f(const char* name, float v0, float v1, float v2, float v3);
+        void uniform4fv(const char* name, int count, const Vector4f* values);
+        void uniformMatrix3f(const char* name, const Matrix3f& m);
         void uniformMatrix4f(const char* name, const Matrix4f& m);
+        void uniformMatrix4fv(const char* name, int count, const Matrix4f* values);
+        void uniformMatrix4x3f(const char* name, const Affine3x4& m);
+        void uniformMatrix4x3fv(const char* name, int count, const Affine3x4* values);
+
+        /* Setters taking a handle from getUniform */
+        void uniform1i(UniformHandle uniform, int i);
+        void uniform1ui(UniformHandle uniform, unsigned int i);
+        void uniform1iv(UniformHandle uniform, int count, int* values);
+        void uniform2i(UniformHandle uniform, int v0, int v1);
+        void uniform2ui(UniformHandle uniform, unsigned int v0, unsigned int v1);
+        void uniform1f(UniformHandle uniform, float value);
+        void uniform1fv(UniformHandle uniform, int count, float* values);
+        void uniform2f(UniformHandle uniform, float v0, float v1);
+        void uniform2fv(UniformHandle uniform, int count, const Vector2f* values);
+        void uniform3f(UniformHandle uniform, float v0, float v1, float v2);
+        void uniform3f(UniformHandle uniform, const Vector3f& v);
+        void uniform3fv(UniformHandle uniform, int count, Vector3f* values);
+        void uniform4f(UniformHandle uniform, float v0, float v1, float v2, float v3);
+        void uniform4fv(UniformHandle uniform, int count, const Vector4f* values);
+        void uniformMatrix3f(UniformHandle uniform, const Matrix3f& m);
+        void uniformMatrix4f(UniformHandle uniform, const Matrix4f& m);
+        void uniformMatrix4fv(UniformHandle uniform, int count, const Matrix4f* values);
+        void uniformMatrix4x3f(UniformHandle uniform, const Affine3x4& m);
+        void uniformMatrix4x3fv(UniformHandle uniform, int count, const Affine3x4* values);
 
     private:
-        void link();
+        // Uniform names sorted for binary search with plain strcmp, so lookups need no std::string
+        struct UniformName
+        {
+            std::string name;
+            UniformHandle handle;
+        };
+
+        // Last value set of an active uniform, the first knownSize bytes at offset in _shadowData are valid,
+        // array elements set on their own are stored in place but only extend knownSize when contiguous with it
+        struct UniformShadow
+        {
+            size_t offset;
+            size_t size;
+            size_t knownSize;
+        };
+
+        void checkLinkStatus();
+        void finishBuild();
         void validate();
         void attach(const Shader& shader);
         void detachAll();
 
         std::string getInfoLog();
-        GLint getUniformLocation(const char* name);
+        void reflectUniforms();
+
+        uint64_t getBinaryKey() const;
+        bool loadBinary(uint64_t key);
+        void storeBinary(uint64_t key);
+
+        /**
+         * Compares a value about to be set with the shadow copy of the uniform
+         * and stores it when different
+         *
+         * @return true if the glUniform call is needed
+         */
+        bool updateShadow(UniformHandle uniform, const void* data, size_t size);
 
     private:
         bool _isCreated;
         bool _isLinked;
         bool _isValidated;
+        bool _isLoadedFromBinary;
+        bool _isBuilding;
+        bool _isSeparable;
+
+        ProgramBinaryCache* _binaryCache;
+        bool _useBinaryCache;
+        uint64_t _binaryKey;
 
         std::vector<std::string> errorLog;
         std::vector<Shader> _attachedShaders;
-        std::unordered_map<std::string, int> _locationMap;
+
+        ProgramReflection _reflection;
+        std::vector<UniformInfo> _uniforms;
+        std::vector<UniformName> _uniformNames;
+        std::vector<UniformShadow> _shadows;
+        std::vector<unsigned char> _shadowData;
+        UniformStatistics _statistics;
 
         GLuint _handle;
+        uint64_t _generation;
     };
 #ifdef GDT_NAMESPACE
 }
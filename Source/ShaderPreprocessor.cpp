@@ -0,0 +1,310 @@
+#include "ShaderPreprocessor.h"
+
+#include "Shader.h"
+#include "File.h"
+
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <sstream>
+
+#ifdef GDT_NAMESPACE
+namespace GDT
+{
+#endif
+    namespace
+    {
+        std::string getDirectory(const std::string& path)
+        {
+            size_t slash = path.find_last_of("/\\");
+            return slash == std::string::npos ? std::string() : path.substr(0, slash + 1);
+        }
+
+        // Collapses "." and ".." segments, so a file reached along different paths is recognized
+        std::string normalizePath(const std::string& path)
+        {
+            std::vector<std::string> segments;
+            bool isAbsolute = !path.empty() && (path[0] == '/' || path[0] == '\\');
+
+            size_t start = 0;
+            while (start <= path.size())
+            {
+                size_t end = path.find_first_of("/\\", start);
+                if (end == std::string::npos)
+                    end = path.size();
+
+                std::string segment = path.substr(start, end - start);
+                if (segment == "..")
+                {
+                    if (!segments.empty() && segments.back() != "..")
+                        segments.pop_back();
+                    else if (!isAbsolute)
+                        segments.push_back(segment);
+                }
+                else if (!segment.empty() && segment != ".")
+                {
+                    segments.push_back(segment);
+                }
+                start = end + 1;
+            }
+
+            std::string normalized = isAbsolute ? "/" : "";
+            for (size_t i = 0; i < segments.size(); i++)
+            {
+                if (i > 0)
+                    normalized += '/';
+                normalized += segments[i];
+            }
+            return normalized;
+        }
+
+        bool fileExists(const std::string& path)
+        {
+            std::ifstream file(path);
+            return file.is_open();
+        }
+
+        // Returns the directive name of a preprocessor line and where its arguments start
+        bool parseDirective(const std::string& line, std::string& directive, size_t& argumentStart)
+        {
+            size_t i = line.find_first_not_of(" \t");
+            if (i == std::string::npos || line[i] != '#')
+                return false;
+
+            i = line.find_first_not_of(" \t", i + 1);
+            if (i == std::string::npos)
+                return false;
+
+            size_t end = i;
+            while (end < line.size() && isalpha((unsigned char) line[end]))
+                end++;
+
+            directive = line.substr(i, end - i);
+            argumentStart = end;
+            return true;
+        }
+
+        // Tracks block comments so directives inside them are left alone
+        bool updateComment(const std::string& line, bool inComment)
+        {
+            for (size_t i = 0; i + 1 < line.size(); i++)
+            {
+                if (inComment)
+                {
+                    if (line[i] == '*' && line[i + 1] == '/')
+                    {
+                        inComment = false;
+                        i++;
+                    }
+                }
+                else if (line[i] == '/' && line[i + 1] == '/')
+                {
+                    break;
+                }
+                else if (line[i] == '/' && line[i + 1] == '*')
+                {
+                    inComment = true;
+                    i++;
+                }
+            }
+            return inComment;
+        }
+
+        void appendLineDirective(std::string& out, int line, int fileIndex)
+        {
+            out += "#line ";
+            out += std::to_string(line);
+            out += ' ';
+            out += std::to_string(fileIndex);
+            out += '\n';
+        }
+
+        void appendDefines(std::string& out, const std::vector<ShaderDefine>& defines)
+        {
+            for (const ShaderDefine& define : defines)
+            {
+                out += "#define ";
+                out += define.name;
+                if (!define.value.empty())
+                {
+                    out += ' ';
+                    out += define.value;
+                }
+                out += '\n';
+            }
+        }
+
+        bool isDigit(char c)
+        {
+            return c >= '0' && c <= '9';
+        }
+    }
+
+    std::string PreprocessedSource::mapLog(const std::string& log) const
+    {
+        return mapSourceFiles(log, files);
+    }
+
+    std::string mapSourceFiles(const std::string& log, const std::vector<std::string>& files)
+    {
+        std::istringstream in(log);
+        std::string result;
+        std::string line;
+
+        while (std::getline(in, line))
+        {
+            // Drivers prefix a location with the source string number, as in "0(12)", "0:12(5)" or "ERROR: 0:12:"
+            for (size_t i = 0; i < line.size(); i++)
+            {
+                if (!isDigit(line[i]) || (i > 0 && line[i - 1] != ' '))
+                    continue;
+
+                size_t end = i;
+                while (end < line.size() && isDigit(line[end]))
+                    end++;
+
+                if (end + 1 >= line.size() || (line[end] != '(' && line[end] != ':') || !isDigit(line[end + 1]))
+                    continue;
+
+                size_t fileIndex = std::stoul(line.substr(i, end - i));
+                if (fileIndex < files.size())
+                    line.replace(i, end - i, files[fileIndex]);
+                break;
+            }
+
+            result += line;
+            result += '\n';
+        }
+        return result;
+    }
+
+    ShaderPreprocessor::ShaderPreprocessor()
+    {
+
+    }
+
+    void ShaderPreprocessor::addIncludePath(std::string path)
+    {
+        if (!path.empty() && path.back() != '/' && path.back() != '\\')
+            path += '/';
+
+        _includePaths.push_back(path);
+    }
+
+    PreprocessedSource ShaderPreprocessor::processFile(const std::string& path, const std::vector<ShaderDefine>& defines) const
+    {
+        std::string source;
+        try
+        {
+            source = loadFile(path);
+        }
+        catch (const FileNotFoundException& e)
+        {
+            throw ShaderLoadingException(e.what());
+        }
+
+        return process(source, path, defines);
+    }
+
+    PreprocessedSource ShaderPreprocessor::process(const std::string& source, const std::string& name, const std::vector<ShaderDefine>& defines) const
+    {
+        PreprocessedSource result;
+        result.files.push_back(normalizePath(name));
+
+        bool definesInjected = false;
+        append(source, 0, result, &defines, definesInjected);
+
+        // Without a #version directive the defines go first
+        if (!definesInjected && !defines.empty())
+        {
+            std::string header;
+            appendDefines(header, defines);
+            appendLineDirective(header, 1, 0);
+            result.source.insert(0, header);
+        }
+        return result;
+    }
+
+    void ShaderPreprocessor::append(const std::string& source, int fileIndex, PreprocessedSource& result,
+        const std::vector<ShaderDefine>* defines, bool& definesInjected) const
+    {
+        std::istringstream in(source);
+        std::string line;
+        int lineNumber = 0;
+        bool inComment = false;
+
+        while (std::getline(in, line))
+        {
+            lineNumber++;
+
+            std::string directive;
+            size_t argumentStart = 0;
+            bool isDirective = !inComment && parseDirective(line, directive, argumentStart);
+            inComment = updateComment(line, inComment);
+
+            if (isDirective && directive == "version" && defines && !definesInjected)
+            {
+                result.source += line;
+                result.source += '\n';
+                appendDefines(result.source, *defines);
+                appendLineDirective(result.source, lineNumber + 1, fileIndex);
+                definesInjected = true;
+                continue;
+            }
+
+            if (!isDirective || directive != "include")
+            {
+                result.source += line;
+                result.source += '\n';
+                continue;
+            }
+
+            size_t open = line.find_first_of("\"<", argumentStart);
+            size_t close = open == std::string::npos ? open : line.find_first_of("\">", open + 1);
+            if (close == std::string::npos)
+                throw ShaderLoadingException(result.files[fileIndex] + "(" + std::to_string(lineNumber) + "): malformed #include");
+
+            std::string includeName = line.substr(open + 1, close - open - 1);
+            std::vector<std::string> candidates = getIncludeCandidates(includeName, result.files[fileIndex]);
+            std::vector<std::string>::iterator found = std::find_if(candidates.begin(), candidates.end(),
+                [](const std::string& candidate) { return fileExists(candidate); });
+
+            if (found == candidates.end())
+            {
+                std::vector<std::string> files = result.files;
+                files.insert(files.end(), candidates.begin(), candidates.end());
+                throw ShaderIncludeException("Failed to find include file: " + includeName +
+                    " included from " + result.files[fileIndex] + "(" + std::to_string(lineNumber) + ")", files);
+            }
+            std::string path = *found;
+
+            // Files included before are skipped, the empty line keeps the numbering intact
+            if (std::find(result.files.begin(), result.files.end(), path) != result.files.end())
+            {
+                result.source += '\n';
+                continue;
+            }
+
+            int includeIndex = (int) result.files.size();
+            result.files.push_back(path);
+
+            appendLineDirective(result.source, 1, includeIndex);
+            append(loadFile(path), includeIndex, result, nullptr, definesInjected);
+            appendLineDirective(result.source, lineNumber + 1, fileIndex);
+        }
+    }
+
+    std::vector<std::string> ShaderPreprocessor::getIncludeCandidates(const std::string& name, const std::string& includer) const
+    {
+        // Next to the including file first, then in the include paths in the order they were added
+        std::vector<std::string> candidates;
+        candidates.push_back(normalizePath(getDirectory(includer) + name));
+
+        for (const std::string& includePath : _includePaths)
+            candidates.push_back(normalizePath(includePath + name));
+
+        return candidates;
+    }
+#ifdef GDT_NAMESPACE
+}
+#endif
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "Shader.h"
+
+#include <string>
+#include <vector>
+
+#ifdef GDT_NAMESPACE
+namespace GDT
+{
+#endif
+    struct ShaderDefine
+    {
+        std::string name;
+        std::string value;
+    };
+
+    /**
+     * Thrown when an included file cannot be found. Lists the files read up
+     * to the failing #include and every path the include was looked for at,
+     * so the caller can watch for the file to appear.
+     */
+    struct ShaderIncludeException : public ShaderLoadingException
+    {
+        ShaderIncludeException(std::string error, std::vector<std::string> files)
+            : ShaderLoadingException(error), files(files)
+        { }
+
+        std::vector<std::string> files;
+    };
+
+    /**
+     * Shader source after preprocessing, along with the files it was put
+     * together from. The #line directives in the source refer to files by
+     * their index in this list, which mapLog() turns back into names.
+     */
+    struct PreprocessedSource
+    {
+        std::string source;
+        std::vector<std::string> files;
+
+        /* Replaces the source string numbers in a compiler log by file names */
+        std::string mapLog(const std::string& log) const;
+    };
+
+    /**
+     * Replaces the source string numbers in a compiler log by file names
+     *
+     * @param log   The info log of a shader
+     * @param files The files of the source, indexed by source string number
+     * @return the log with "0(12)" and "0:12" locations naming their file
+     */
+    std::string mapSourceFiles(const std::string& log, const std::vector<std::string>& files);
+
+    /**
+     * Resolves #include "file" directives and injects #define directives
+     * into shader sources before they are handed to the GL. Includes are
+     * looked up next to the including file first and then in the include
+     * paths, and every file is included once per shader however often it
+     * is requested, as if all of them had include guards.
+     */
+    class ShaderPreprocessor
+    {
+    public:
+        ShaderPreprocessor();
+
+        /* Adds a directory to search for included files */
+        void addIncludePath(std::string path);
+
+        /**
+         * Loads and preprocesses a shader file. Throws a ShaderLoadingException
+         * if the file cannot be found, or a ShaderIncludeException if one of
+         * its includes cannot.
+         *
+         * @param path    The path of the shader file
+         * @param defines Defines to inject directly after the #version directive
+         * @return the preprocessed source
+         */
+        PreprocessedSource processFile(const std::string& path, const std::vector<ShaderDefine>& defines = {}) const;
+
+        /**
+         * Preprocesses shader source held in memory
+         *
+         * @param source  The shader source
+         * @param name    The name to report the source as, includes are resolved relative to it
+         * @param defines Defines to inject directly after the #version directive
+         * @return the preprocessed source
+         */
+        PreprocessedSource process(const std::string& source, const std::string& name, const std::vector<ShaderDefine>& defines = {}) const;
+
+    private:
+        void append(const std::string& source, int fileIndex, PreprocessedSource& result,
+            const std::vector<ShaderDefine>* defines, bool& definesInjected) const;
+
+        std::vector<std::string> getIncludeCandidates(const std::string& name, const std::string& includer) const;
+
+        std::vector<std::string> _includePaths;
+    };
+#ifdef GDT_NAMESPACE
+}
+#endif
@@ -0,0 +1,214 @@
+#include "ShaderReloader.h"
+
+#include <algorithm>
+
+#ifdef GDT_NAMESPACE
+namespace GDT
+{
+#endif
+    namespace
+    {
+        // How often the worker checks whether it should stop
+        const int WATCH_INTERVAL_MS = 100;
+
+        // Editors touch a file several times when saving, changes this close together are handled at once
+        const int SETTLE_TIME_MS = 50;
+
+        bool containsAny(const std::vector<std::string>& files, const std::vector<std::string>& changed)
+        {
+            for (const std::string& path : changed)
+            {
+                if (std::find(files.begin(), files.end(), path) != files.end())
+                    return true;
+            }
+            return false;
+        }
+    }
+
+    ShaderReloader::ShaderReloader(const ShaderPreprocessor& preprocessor) :
+        _preprocessor(preprocessor),
+        _running(true)
+    {
+        _worker = std::thread(&ShaderReloader::run, this);
+    }
+
+    ShaderReloader::~ShaderReloader()
+    {
+        _running = false;
+        _worker.join();
+    }
+
+    void ShaderReloader::add(ShaderProgram& program, const std::vector<std::pair<ShaderType, std::string>>& files,
+        const std::vector<ShaderDefine>& defines)
+    {
+        Entry entry = { &program, files, defines, {} };
+
+        PendingReload reload;
+        if (!preprocess(entry, reload))
+            throw ShaderLoadingException(reload.error);
+
+        program.create();
+        for (size_t i = 0; i < files.size(); i++)
+        {
+            program.addShader(files[i].first, reload.sources[i]);
+            entry.files.insert(entry.files.end(), reload.sources[i].files.begin(), reload.sources[i].files.end());
+        }
+        program.build();
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        _entries.push_back(entry);
+    }
+
+    std::vector<ShaderReloadReport> ShaderReloader::update()
+    {
+        std::vector<PendingReload> pending;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_pending.empty())
+                return std::vector<ShaderReloadReport>();
+
+            pending.swap(_pending);
+        }
+
+        std::vector<ShaderReloadReport> reports;
+        for (PendingReload& reload : pending)
+        {
+            ShaderProgram* program;
+            std::vector<std::pair<ShaderType, std::string>> stages;
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                program = _entries[reload.entry].program;
+                stages = _entries[reload.entry].stages;
+            }
+
+            ShaderReloadReport report = { program, false, 0, reload.error };
+            if (report.error.empty())
+            {
+                // Build next to the current program, so it stays in use if the build fails
+                ShaderProgram rebuilt;
+                rebuilt.create();
+                rebuilt.setBinaryCache(program->getBinaryCache());
+                rebuilt.setSeparable(program->isSeparable());
+
+                try
+                {
+                    for (size_t i = 0; i < stages.size(); i++)
+                        rebuilt.addShader(stages[i].first, reload.sources[i]);
+
+                    rebuilt.build();
+
+                    std::swap(*program, rebuilt);
+                    rebuilt.destroy();
+                    report.success = true;
+                }
+                catch (const ShaderLoadingException& e)
+                {
+                    rebuilt.destroy();
+                    report.error = e.what();
+                }
+
+                // Watch the includes of the new sources, even if they failed to compile
+                std::vector<std::string> files;
+                for (const PreprocessedSource& source : reload.sources)
+                    files.insert(files.end(), source.files.begin(), source.files.end());
+
+                std::lock_guard<std::mutex> lock(_mutex);
+                _entries[reload.entry].files = files;
+            }
+
+            report.milliseconds = std::chrono::duration<double, std::milli>(Clock::now() - reload.changeTime).count();
+            reports.push_back(report);
+        }
+        return reports;
+    }
+
+    void ShaderReloader::run()
+    {
+        while (_running)
+        {
+            // Pick up the files of programs added or reloaded since the last wait
+            std::vector<Entry> entries;
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                entries = _entries;
+            }
+
+            for (const Entry& entry : entries)
+            {
+                for (const std::string& path : entry.files)
+                    _watcher.watch(path);
+            }
+
+            std::vector<std::string> changed = _watcher.waitForChanges(WATCH_INTERVAL_MS);
+            if (changed.empty())
+                continue;
+
+            Clock::time_point changeTime = Clock::now();
+
+            std::vector<std::string> settled = _watcher.waitForChanges(SETTLE_TIME_MS);
+            changed.insert(changed.end(), settled.begin(), settled.end());
+
+            std::vector<PendingReload> reloads;
+            for (size_t i = 0; i < entries.size(); i++)
+            {
+                if (!containsAny(entries[i].files, changed))
+                    continue;
+
+                PendingReload reload;
+                reload.entry = i;
+                reload.changeTime = changeTime;
+                preprocess(entries[i], reload);
+                reloads.push_back(reload);
+            }
+
+            std::lock_guard<std::mutex> lock(_mutex);
+            for (PendingReload& reload : reloads)
+            {
+                // Watch where a missing include may appear right away, the old files stay watched too
+                std::vector<std::string>& files = _entries[reload.entry].files;
+                for (const std::string& path : reload.files)
+                {
+                    if (std::find(files.begin(), files.end(), path) == files.end())
+                        files.push_back(path);
+                    _watcher.watch(path);
+                }
+
+                // A newer version of the same program replaces one that was not picked up yet
+                std::vector<PendingReload>::iterator it = std::find_if(_pending.begin(), _pending.end(),
+                    [&reload](const PendingReload& p) { return p.entry == reload.entry; });
+
+                if (it != _pending.end())
+                    *it = reload;
+                else
+                    _pending.push_back(reload);
+            }
+        }
+    }
+
+    bool ShaderReloader::preprocess(const Entry& entry, PendingReload& reload) const
+    {
+        reload.sources.clear();
+        reload.error.clear();
+        reload.files.clear();
+
+        try
+        {
+            for (const std::pair<ShaderType, std::string>& stage : entry.stages)
+                reload.sources.push_back(_preprocessor.processFile(stage.second, entry.defines));
+        }
+        catch (const ShaderIncludeException& e)
+        {
+            reload.error = e.what();
+            reload.files = e.files;
+            return false;
+        }
+        catch (const std::exception& e)
+        {
+            reload.error = e.what();
+            return false;
+        }
+        return true;
+    }
+#ifdef GDT_NAMESPACE
+}
+#endif
@@ -0,0 +1,109 @@
+#pragma once
+
+#include "Shader.h"
+#include "ShaderPreprocessor.h"
+#include "FileWatcher.h"
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef GDT_NAMESPACE
+namespace GDT
+{
+#endif
+    struct ShaderReloadReport
+    {
+        ShaderProgram* program;
+        bool success;
+        // Time from noticing the change to the new program being ready
+        double milliseconds;
+        // Compiler or preprocessor output of a failed reload
+        std::string error;
+    };
+
+    /**
+     * Rebuilds programs when their shader files or any file they include
+     * change on disk. A worker thread watches the files and preprocesses
+     * the sources of affected programs, update() then compiles them on the
+     * render thread and swaps the new program into place. A program that
+     * fails to build is reported and the previous one stays in use.
+     *
+     * Reloading replaces the program object, so uniform handles obtained
+     * from it before have to be resolved again.
+     */
+    class ShaderReloader
+    {
+    public:
+        /**
+         * @param preprocessor The preprocessor used to load the shader files,
+         *                     which has to outlive the reloader
+         */
+        ShaderReloader(const ShaderPreprocessor& preprocessor);
+        ~ShaderReloader();
+
+        ShaderReloader(const ShaderReloader&) = delete;
+        ShaderReloader& operator=(const ShaderReloader&) = delete;
+
+        /**
+         * Builds a program from shader files and keeps it up to date with
+         * them. Throws a ShaderLoadingException if the first build fails.
+         *
+         * @param program The program to build, which has to outlive the reloader
+         * @param files   The type and path of every shader of the program
+         * @param defines Defines injected into every shader
+         */
+        void add(ShaderProgram& program, const std::vector<std::pair<ShaderType, std::string>>& files,
+            const std::vector<ShaderDefine>& defines = {});
+
+        /**
+         * Rebuilds the programs whose sources changed, to be called on the
+         * render thread, for instance once per frame
+         *
+         * @return a report for every program that was reloaded or failed to
+         */
+        std::vector<ShaderReloadReport> update();
+
+    private:
+        typedef std::chrono::steady_clock Clock;
+
+        struct Entry
+        {
+            ShaderProgram* program;
+            std::vector<std::pair<ShaderType, std::string>> stages;
+            std::vector<ShaderDefine> defines;
+            // Every file the program was built from, including those included
+            std::vector<std::string> files;
+        };
+
+        struct PendingReload
+        {
+            size_t entry;
+            std::vector<PreprocessedSource> sources;
+            std::string error;
+            // Files to watch after failed preprocessing, including the paths of a missing include
+            std::vector<std::string> files;
+            Clock::time_point changeTime;
+        };
+
+        void run();
+        bool preprocess(const Entry& entry, PendingReload& reload) const;
+
+        const ShaderPreprocessor& _preprocessor;
+
+        std::mutex _mutex;
+        std::vector<Entry> _entries;
+        std::vector<PendingReload> _pending;
+
+        // Only used by the worker thread
+        FileWatcher _watcher;
+
+        std::atomic<bool> _running;
+        std::thread _worker;
+    };
+#ifdef GDT_NAMESPACE
+}
+#endif
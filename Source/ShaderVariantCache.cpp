@@ -0,0 +1,133 @@
+#include "ShaderVariantCache.h"
+
+#include "Hash.h"
+
+#include <algorithm>
+#include <utility>
+
+#ifdef GDT_NAMESPACE
+namespace GDT
+{
+#endif
+    namespace
+    {
+        bool nameLess(const ShaderDefine& a, const ShaderDefine& b)
+        {
+            return a.name < b.name;
+        }
+    }
+
+    ShaderVariantCache::ShaderVariantCache(const ShaderPreprocessor& preprocessor) :
+        _preprocessor(preprocessor),
+        _binaryCache(nullptr)
+    {
+
+    }
+
+    void ShaderVariantCache::addShaderFile(ShaderType type, std::string path)
+    {
+        _files.push_back(ShaderFile{ type, path });
+    }
+
+    void ShaderVariantCache::setBinaryCache(ProgramBinaryCache* cache)
+    {
+        _binaryCache = cache;
+    }
+
+    ShaderProgram& ShaderVariantCache::get(const std::vector<ShaderDefine>& requested)
+    {
+        std::vector<ShaderDefine> defines = canonicalDefines(requested);
+        uint64_t hash = hashDefines(defines);
+
+        auto range = _variants.equal_range(hash);
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            if (sameDefines(it->second.defines, defines))
+                return *it->second.program;
+        }
+
+        // Preprocessing may throw, so it happens before there is a program to clean up
+        std::vector<PreprocessedSource> sources;
+        for (const ShaderFile& file : _files)
+            sources.push_back(_preprocessor.processFile(file.path, defines));
+
+        std::unique_ptr<ShaderProgram> program(new ShaderProgram());
+        program->create();
+        program->setBinaryCache(_binaryCache);
+
+        try
+        {
+            for (size_t i = 0; i < _files.size(); i++)
+                program->addShader(_files[i].type, sources[i]);
+        }
+        catch (...)
+        {
+            program->destroy();
+            throw;
+        }
+
+        // A failed build destroys the program itself
+        program->build();
+
+        ShaderProgram& result = *program;
+        _variants.insert(std::make_pair(hash, Variant{ defines, std::move(program) }));
+        return result;
+    }
+
+    size_t ShaderVariantCache::size() const
+    {
+        return _variants.size();
+    }
+
+    void ShaderVariantCache::clear()
+    {
+        for (auto& variant : _variants)
+            variant.second.program->destroy();
+
+        _variants.clear();
+    }
+
+    std::vector<ShaderDefine> ShaderVariantCache::canonicalDefines(const std::vector<ShaderDefine>& defines)
+    {
+        // The stable sort keeps repeated names in the order given, so the last one of each is the one the shader sees
+        std::vector<ShaderDefine> sorted(defines);
+        std::stable_sort(sorted.begin(), sorted.end(), nameLess);
+
+        std::vector<ShaderDefine> canonical;
+        canonical.reserve(sorted.size());
+        for (ShaderDefine& define : sorted)
+        {
+            if (!canonical.empty() && canonical.back().name == define.name)
+                canonical.back().value = std::move(define.value);
+            else
+                canonical.push_back(std::move(define));
+        }
+        return canonical;
+    }
+
+    uint64_t ShaderVariantCache::hashDefines(const std::vector<ShaderDefine>& defines)
+    {
+        uint64_t hash = Hash::FNV_OFFSET_BASIS;
+        for (const ShaderDefine& define : defines)
+        {
+            hash = Hash::fnv1a(define.name, hash);
+            hash = Hash::fnv1a(define.value, hash);
+        }
+        return hash;
+    }
+
+    bool ShaderVariantCache::sameDefines(const std::vector<ShaderDefine>& a, const std::vector<ShaderDefine>& b)
+    {
+        if (a.size() != b.size())
+            return false;
+
+        for (size_t i = 0; i < a.size(); i++)
+        {
+            if (a[i].name != b[i].name || a[i].value != b[i].value)
+                return false;
+        }
+        return true;
+    }
+#ifdef GDT_NAMESPACE
+}
+#endif
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "Shader.h"
+#include "ShaderPreprocessor.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#ifdef GDT_NAMESPACE
+namespace GDT
+{
+#endif
+    /**
+     * Builds permutations of one set of shader files on demand. Every
+     * distinct set of defines requested is preprocessed, built and kept,
+     * so only the variants actually used are ever compiled.
+     */
+    class ShaderVariantCache
+    {
+    public:
+        /**
+         * @param preprocessor The preprocessor resolving the includes of the shader files,
+         *                     which has to outlive the cache
+         */
+        ShaderVariantCache(const ShaderPreprocessor& preprocessor);
+
+        /* Adds a shader file every variant is built from */
+        void addShaderFile(ShaderType type, std::string path);
+
+        /* Binary cache passed on to the programs of new variants, or nullptr */
+        void setBinaryCache(ProgramBinaryCache* cache);
+
+        /**
+         * Returns the program built with the given defines, building it the
+         * first time the set is requested. The order of the defines does not
+         * matter, and of a name given more than once only the last value
+         * counts. Throws a ShaderLoadingException if the build fails, after
+         * which the next request of the set tries again.
+         *
+         * @param defines The defines of the variant
+         * @return the program, which stays valid until clear() is called
+         */
+        ShaderProgram& get(const std::vector<ShaderDefine>& defines);
+
+        /* Number of variants built */
+        size_t size() const;
+
+        /* Destroys the programs of all variants */
+        void clear();
+
+        /**
+         * Sorts defines by name and keeps only the last value of a name
+         * given more than once, which is the value the shader sees. Sets of
+         * defines that build the same shader have the same canonical list.
+         */
+        static std::vector<ShaderDefine> canonicalDefines(const std::vector<ShaderDefine>& defines);
+
+        /* Hash of a canonical list of defines */
+        static uint64_t hashDefines(const std::vector<ShaderDefine>& defines);
+
+        /* Whether two canonical lists of defines are equal */
+        static bool sameDefines(const std::vector<ShaderDefine>& a, const std::vector<ShaderDefine>& b);
+
+    private:
+        struct ShaderFile
+        {
+            ShaderType type;
+            std::string path;
+        };
+
+        struct Variant
+        {
+            // Canonical, so lookups compare them element by element
+            std::vector<ShaderDefine> defines;
+            std::unique_ptr<ShaderProgram> program;
+        };
+
+        const ShaderPreprocessor& _preprocessor;
+        ProgramBinaryCache* _binaryCache;
+
+        std::vector<ShaderFile> _files;
+        std::unordered_multimap<uint64_t, Variant> _variants;
+    };
+#ifdef GDT_NAMESPACE
+}
+#endif
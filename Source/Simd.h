@@ -0,0 +1,168 @@
+#pragma once
+
+// The SIMD backend is selected at compile time from the instruction set the
+// compiler targets. Defining GDT_SIMD_NONE forces the scalar fallback.
+#if !defined(GDT_SIMD_NONE)
+#if defined(__AVX__)
+#define GDT_SIMD_AVX
+#define GDT_SIMD_SSE
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define GDT_SIMD_SSE
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define GDT_SIMD_NEON
+#endif
+#endif
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#if defined(GDT_SIMD_AVX)
+#include <immintrin.h>
+#elif defined(GDT_SIMD_SSE)
+#include <emmintrin.h>
+#elif defined(GDT_SIMD_NEON)
+#include <arm_neon.h>
+#endif
+
+// Alignment in bytes of the widest register used by the selected backend
+#if defined(GDT_SIMD_AVX)
+#define GDT_SIMD_ALIGNMENT 32
+#else
+#define GDT_SIMD_ALIGNMENT 16
+#endif
+
+// Optionally aligns the storage of the math classes to GDT_SIMD_ALIGNMENT,
+// this changes the alignment of the classes so it has to be defined
+// consistently for the library and all code using it.
+#ifdef GDT_ALIGNED_MATRIX
+#define GDT_SIMD_ALIGN alignas(GDT_SIMD_ALIGNMENT)
+#else
+#define GDT_SIMD_ALIGN
+#endif
+
+// Defined when Simd::Float4 maps to hardware registers rather than the scalar emulation
+#if defined(GDT_SIMD_SSE) || defined(GDT_SIMD_NEON)
+#define GDT_SIMD_FLOAT4
+#endif
+
+#ifdef GDT_NAMESPACE
+namespace GDT
+{
+#endif
+    /**
+     * Thin wrappers around the 4-wide float operations of the SSE and NEON
+     * backends, emulated with plain floats when no backend is available.
+     * Multiplies and adds are never fused so results stay bit-identical to
+     * the scalar code. Comparisons return all-ones lanes where true.
+     */
+    namespace Simd
+    {
+#if defined(GDT_SIMD_SSE)
+        typedef __m128 Float4;
+
+        inline Float4 load(const float* p) { return _mm_loadu_ps(p); }
+        inline void store(float* p, Float4 v) { _mm_storeu_ps(p, v); }
+        inline Float4 set1(float f) { return _mm_set1_ps(f); }
+        inline Float4 add(Float4 a, Float4 b) { return _mm_add_ps(a, b); }
+        inline Float4 sub(Float4 a, Float4 b) { return _mm_sub_ps(a, b); }
+        inline Float4 mul(Float4 a, Float4 b) { return _mm_mul_ps(a, b); }
+        inline Float4 div(Float4 a, Float4 b) { return _mm_div_ps(a, b); }
+        inline Float4 sqrt(Float4 a) { return _mm_sqrt_ps(a); }
+        inline Float4 min(Float4 a, Float4 b) { return _mm_min_ps(a, b); }
+        inline Float4 max(Float4 a, Float4 b) { return _mm_max_ps(a, b); }
+        inline Float4 greaterThan(Float4 a, Float4 b) { return _mm_cmpgt_ps(a, b); }
+        inline Float4 bitAnd(Float4 a, Float4 b) { return _mm_and_ps(a, b); }
+        inline Float4 bitOr(Float4 a, Float4 b) { return _mm_or_ps(a, b); }
+        inline int moveMask(Float4 a) { return _mm_movemask_ps(a); }
+#elif defined(GDT_SIMD_NEON)
+        typedef float32x4_t Float4;
+
+        inline Float4 load(const float* p) { return vld1q_f32(p); }
+        inline void store(float* p, Float4 v) { vst1q_f32(p, v); }
+        inline Float4 set1(float f) { return vdupq_n_f32(f); }
+        inline Float4 add(Float4 a, Float4 b) { return vaddq_f32(a, b); }
+        inline Float4 sub(Float4 a, Float4 b) { return vsubq_f32(a, b); }
+        inline Float4 mul(Float4 a, Float4 b) { return vmulq_f32(a, b); }
+        inline Float4 min(Float4 a, Float4 b) { return vminq_f32(a, b); }
+        inline Float4 max(Float4 a, Float4 b) { return vmaxq_f32(a, b); }
+        inline Float4 greaterThan(Float4 a, Float4 b) { return vreinterpretq_f32_u32(vcgtq_f32(a, b)); }
+        inline Float4 bitAnd(Float4 a, Float4 b) { return vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(a), vreinterpretq_u32_f32(b))); }
+        inline Float4 bitOr(Float4 a, Float4 b) { return vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(a), vreinterpretq_u32_f32(b))); }
+        inline int moveMask(Float4 a)
+        {
+            uint32x4_t bits = vshrq_n_u32(vreinterpretq_u32_f32(a), 31);
+            return (int) (vgetq_lane_u32(bits, 0) | (vgetq_lane_u32(bits, 1) << 1) | (vgetq_lane_u32(bits, 2) << 2) | (vgetq_lane_u32(bits, 3) << 3));
+        }
+#if defined(__aarch64__) || defined(_M_ARM64)
+        inline Float4 div(Float4 a, Float4 b) { return vdivq_f32(a, b); }
+        inline Float4 sqrt(Float4 a) { return vsqrtq_f32(a); }
+#else
+        // ARMv7 NEON only has estimates, compute per lane for exact results
+        inline Float4 div(Float4 a, Float4 b)
+        {
+            float x[4], y[4];
+            vst1q_f32(x, a); vst1q_f32(y, b);
+            for (int i = 0; i < 4; i++) x[i] /= y[i];
+            return vld1q_f32(x);
+        }
+        inline Float4 sqrt(Float4 a)
+        {
+            float x[4];
+            vst1q_f32(x, a);
+            for (int i = 0; i < 4; i++) x[i] = std::sqrt(x[i]);
+            return vld1q_f32(x);
+        }
+#endif
+#else
+        struct Float4 { float v[4]; };
+
+        inline Float4 load(const float* p) { Float4 r; for (int i = 0; i < 4; i++) r.v[i] = p[i]; return r; }
+        inline void store(float* p, Float4 a) { for (int i = 0; i < 4; i++) p[i] = a.v[i]; }
+        inline Float4 set1(float f) { Float4 r; for (int i = 0; i < 4; i++) r.v[i] = f; return r; }
+        inline Float4 add(Float4 a, Float4 b) { for (int i = 0; i < 4; i++) a.v[i] += b.v[i]; return a; }
+        inline Float4 sub(Float4 a, Float4 b) { for (int i = 0; i < 4; i++) a.v[i] -= b.v[i]; return a; }
+        inline Float4 mul(Float4 a, Float4 b) { for (int i = 0; i < 4; i++) a.v[i] *= b.v[i]; return a; }
+        inline Float4 div(Float4 a, Float4 b) { for (int i = 0; i < 4; i++) a.v[i] /= b.v[i]; return a; }
+        inline Float4 sqrt(Float4 a) { for (int i = 0; i < 4; i++) a.v[i] = std::sqrt(a.v[i]); return a; }
+        inline Float4 min(Float4 a, Float4 b) { for (int i = 0; i < 4; i++) a.v[i] = a.v[i] < b.v[i] ? a.v[i] : b.v[i]; return a; }
+        inline Float4 max(Float4 a, Float4 b) { for (int i = 0; i < 4; i++) a.v[i] = a.v[i] > b.v[i] ? a.v[i] : b.v[i]; return a; }
+        inline Float4 greaterThan(Float4 a, Float4 b)
+        {
+            Float4 r;
+            for (int i = 0; i < 4; i++) { uint32_t bits = a.v[i] > b.v[i] ? 0xFFFFFFFFu : 0u; std::memcpy(&r.v[i], &bits, 4); }
+            return r;
+        }
+        inline Float4 bitAnd(Float4 a, Float4 b)
+        {
+            for (int i = 0; i < 4; i++)
+            {
+                uint32_t x, y;
+                std::memcpy(&x, &a.v[i], 4); std::memcpy(&y, &b.v[i], 4);
+                x &= y;
+                std::memcpy(&a.v[i], &x, 4);
+            }
+            return a;
+        }
+        inline Float4 bitOr(Float4 a, Float4 b)
+        {
+            for (int i = 0; i < 4; i++)
+            {
+                uint32_t x, y;
+                std::memcpy(&x, &a.v[i], 4); std::memcpy(&y, &b.v[i], 4);
+                x |= y;
+                std::memcpy(&a.v[i], &x, 4);
+            }
+            return a;
+        }
+        inline int moveMask(Float4 a)
+        {
+            int mask = 0;
+            for (int i = 0; i < 4; i++) { uint32_t x; std::memcpy(&x, &a.v[i], 4); mask |= (int) (x >> 31) << i; }
+            return mask;
+        }
+#endif
+    }
+#ifdef GDT_NAMESPACE
+}
+#endif
@@ -1,5 +1,10 @@
 #include "Texture.h"
 
+#include "TextureBindingCache.h"
+
+#include <stdexcept>
+#include <string>
+
 #ifdef GDT_NAMESPACE
 namespace GDT
 {
@@ -21,13 +26,22 @@ namespace GDT
     {
         if (!isCreated()) return; // TODO Handle
 
+        if (TextureBindingCache* cache = TextureBindingCache::getCurrent())
+        {
+            cache->bind(textureUnit, target, handle);
+            return;
+        }
+
         glActiveTexture(GL_TEXTURE0 + textureUnit);
         glBindTexture(target, handle);
     }
 
     void Texture::release()
     {
-        glBindTexture(target, 0);
+        if (TextureBindingCache* cache = TextureBindingCache::getCurrent())
+            cache->bindActive(target, 0);
+        else
+            glBindTexture(target, 0);
     }
 
     void Texture::setSampling(Sampling minFilter, Sampling magFilter, Sampling mipFilter)
@@ -48,6 +62,9 @@ namespace GDT
 
         glDeleteTextures(1, &handle);
 
+        if (TextureBindingCache* cache = TextureBindingCache::getCurrent())
+            cache->onDelete(handle);
+
         created = false;
     }
 
@@ -61,6 +78,11 @@ namespace GDT
         return handle;
     }
 
+    GLenum Texture::getTarget() const
+    {
+        return target;
+    }
+
     Texture2D::Texture2D()
         : Texture(GL_TEXTURE_2D)
     {
@@ -81,17 +103,116 @@ namespace GDT
     {
         if (!isCreated()) return;
 
+        bool sameStorage = levels > 0 && width == this->width && height == this->height && internalFormat == this->internalFormat;
+        if (sameStorage || immutable)
+        {
+            setSubData(0, 0, 0, width, height, format, type, data);
+            return;
+        }
+
         this->width = width;
         this->height = height;
+        this->internalFormat = internalFormat;
+        levels = 1;
 
         glTexImage2D(target, 0, internalFormat, width, height, 0, format, type, data);
     }
 
+    void Texture2D::setStorage(uint width, uint height, GLenum internalFormat, uint levels)
+    {
+        if (!isCreated()) return;
+
+        if (levels == 0)
+            levels = getMaxLevels(width, height);
+
+        if (immutable)
+        {
+            if (width == this->width && height == this->height && (GLint) internalFormat == this->internalFormat && levels == this->levels)
+                return;
+
+            // Immutable storage can not be respecified, so start over with a new texture object
+            TextureBindingCache* cache = TextureBindingCache::getCurrent();
+
+            glDeleteTextures(1, &handle);
+            if (cache) cache->onDelete(handle);
+
+            glGenTextures(1, &handle);
+            if (cache) cache->bindActive(target, handle);
+            else glBindTexture(target, handle);
+        }
+
+        this->width = width;
+        this->height = height;
+        this->internalFormat = internalFormat;
+        this->levels = levels;
+        immutable = true;
+
+        glTexStorage2D(target, levels, internalFormat, width, height);
+        glTexParameteri(target, GL_TEXTURE_MAX_LEVEL, levels - 1);
+    }
+
+    void Texture2D::setSubData(uint level, uint x, uint y, uint width, uint height, GLenum format, GLenum type, const void* data, uint rowLength, uint alignment)
+    {
+        if (!isCreated()) return;
+
+        if (level >= levels)
+            throw std::out_of_range("Texture level " + std::to_string(level) + " does not exist");
+
+        uint levelWidth = this->width >> level;
+        uint levelHeight = this->height >> level;
+        if (levelWidth == 0) levelWidth = 1;
+        if (levelHeight == 0) levelHeight = 1;
+
+        if (x + width > levelWidth || y + height > levelHeight)
+            throw std::out_of_range("Texture region lies outside of level " + std::to_string(level));
+
+        // The unpack state is left at the GL defaults of 0 and 4 for everything else
+        if (rowLength != 0) glPixelStorei(GL_UNPACK_ROW_LENGTH, rowLength);
+        if (alignment != 4) glPixelStorei(GL_UNPACK_ALIGNMENT, alignment);
+
+        glTexSubImage2D(target, level, x, y, width, height, format, type, data);
+
+        if (rowLength != 0) glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+        if (alignment != 4) glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    }
+
     void Texture2D::setWrapping(Wrapping sWrapping, Wrapping tWrapping)
     {
         glTexParameteri(target, GL_TEXTURE_WRAP_S, sWrapping);
         glTexParameteri(target, GL_TEXTURE_WRAP_T, tWrapping);
     }
+
+    void Texture2D::destroy()
+    {
+        Texture::destroy();
+
+        internalFormat = 0;
+        levels = 0;
+        immutable = false;
+    }
+
+    bool Texture2D::isImmutable() const
+    {
+        return immutable;
+    }
+
+    uint Texture2D::getLevels() const
+    {
+        return levels;
+    }
+
+    uint Texture2D::getMaxLevels(uint width, uint height)
+    {
+        uint size = width > height ? width : height;
+
+        uint levels = 1;
+        while (size > 1)
+        {
+            size >>= 1;
+            levels++;
+        }
+        return levels;
+    }
 #ifdef GDT_NAMESPACE
 }
 #endif
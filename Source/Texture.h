@@ -41,6 +41,7 @@ namespace GDT
         bool isCreated() const;
 
         GLuint getHandle() const;
+        GLenum getTarget() const;
 
     protected:
         bool created = false;
@@ -55,11 +56,63 @@ namespace GDT
         Texture2D();
         uint getWidth() const;
         uint getHeight() const;
+
+        /**
+         * Uploads level 0 of the texture. Reallocates the storage only when
+         * the size or format differs from the last call, otherwise the data
+         * is updated in place. Textures with immutable storage are always
+         * updated in place, so the size has to fit in level 0.
+         */
         void setData(uint width, uint height, GLint internalFormat, GLenum format, GLenum type, const void* data);
+
+        /**
+         * Allocates immutable storage for the texture with glTexStorage2D.
+         * The storage can not be reallocated, so if the texture already has
+         * storage of another size or format its handle is replaced by a new
+         * one, bound to the current texture unit. Fill the levels with
+         * setSubData.
+         *
+         * @param width          The width of level 0
+         * @param height         The height of level 0
+         * @param internalFormat A sized internal format, e.g. GL_RGBA8
+         * @param levels         The number of mip levels, 0 for the full chain down to 1x1
+         */
+        void setStorage(uint width, uint height, GLenum internalFormat, uint levels = 0);
+
+        /**
+         * Updates a region of one level in place with glTexSubImage2D.
+         * Throws std::out_of_range if the region lies outside the level.
+         *
+         * @param level     The mip level to update
+         * @param x         The left edge of the region
+         * @param y         The bottom edge of the region
+         * @param width     The width of the region
+         * @param height    The height of the region
+         * @param format    The format of the pixels in data
+         * @param type      The type of the pixels in data
+         * @param data      The pixels, or an offset into the bound GL_PIXEL_UNPACK_BUFFER
+         * @param rowLength Pixels per row in data when the region is cut from a wider image, 0 if rows are width long
+         * @param alignment Byte alignment of the rows in data, 1, 2, 4 or 8
+         */
+        void setSubData(uint level, uint x, uint y, uint width, uint height, GLenum format, GLenum type, const void* data, uint rowLength = 0, uint alignment = 4);
+
         void setWrapping(Wrapping sWrapping, Wrapping tWrapping);
 
+        /* Frees the texture along with what is known about its storage */
+        void destroy();
+
+        /* Whether the storage was allocated with setStorage */
+        bool isImmutable() const;
+        uint getLevels() const;
+
+        /* Number of levels in a full mip chain of the given size */
+        static uint getMaxLevels(uint width, uint height);
+
     private:
         uint width, height;
+        GLint internalFormat = 0;
+        uint levels = 0;
+        bool immutable = false;
     };
 #ifdef GDT_NAMESPACE
 }
@@ -0,0 +1,213 @@
+#include "TextureBindingCache.h"
+
+#include "Texture.h"
+#include "Extensions.h"
+
+#include <algorithm>
+
+#ifdef GDT_NAMESPACE
+namespace GDT
+{
+#endif
+    namespace
+    {
+        // Binding that has to be made regardless, because the cache does not know the state of the GL
+        const GLuint UNKNOWN = 0xFFFFFFFF;
+
+        thread_local TextureBindingCache* current = nullptr;
+
+        int getTargetIndex(GLenum target)
+        {
+            switch (target)
+            {
+            case GL_TEXTURE_1D: return 0;
+            case GL_TEXTURE_2D: return 1;
+            case GL_TEXTURE_3D: return 2;
+            case GL_TEXTURE_1D_ARRAY: return 3;
+            case GL_TEXTURE_2D_ARRAY: return 4;
+            case GL_TEXTURE_RECTANGLE: return 5;
+            case GL_TEXTURE_CUBE_MAP: return 6;
+            case GL_TEXTURE_CUBE_MAP_ARRAY: return 7;
+            case GL_TEXTURE_BUFFER: return 8;
+            case GL_TEXTURE_2D_MULTISAMPLE: return 9;
+            case GL_TEXTURE_2D_MULTISAMPLE_ARRAY: return 10;
+            default: return -1;
+            }
+        }
+    }
+
+    TextureBindingCache::TextureBindingCache() :
+        _activeUnit(UNKNOWN),
+        _multiBindEnabled(true),
+        _statistics()
+    {
+
+    }
+
+    void TextureBindingCache::makeCurrent(TextureBindingCache* cache)
+    {
+        current = cache;
+    }
+
+    TextureBindingCache* TextureBindingCache::getCurrent()
+    {
+        return current;
+    }
+
+    void TextureBindingCache::bind(GLuint unit, GLenum target, GLuint texture)
+    {
+        // The unit is made active even if the texture is bound already, since texture parameters are set through it
+        setActiveUnit(unit);
+
+        GLuint* binding = getBinding(unit, target);
+        if (binding && *binding == texture)
+        {
+            _statistics.elided++;
+            return;
+        }
+
+        glBindTexture(target, texture);
+        _statistics.issued++;
+
+        if (binding)
+            *binding = texture;
+    }
+
+    void TextureBindingCache::bindActive(GLenum target, GLuint texture)
+    {
+        if (_activeUnit != UNKNOWN)
+        {
+            bind(_activeUnit, target, texture);
+            return;
+        }
+
+        glBindTexture(target, texture);
+        _statistics.issued++;
+
+        // Whichever unit is active now has an unknown binding for the target
+        int index = getTargetIndex(target);
+        if (index < 0) return;
+
+        for (Unit& unit : _units)
+            unit.textures[index] = UNKNOWN;
+    }
+
+    void TextureBindingCache::bindTextures(GLuint first, const std::vector<const Texture*>& textures)
+    {
+        bool multiBind = _multiBindEnabled && Extensions::hasMultiBind();
+
+        // Handles of a run of consecutive units to bind with a single call
+        std::vector<GLuint> run;
+        GLuint runFirst = first;
+
+        for (size_t i = 0; i <= textures.size(); i++)
+        {
+            GLuint unit = first + (GLuint) i;
+            const Texture* texture = i < textures.size() ? textures[i] : nullptr;
+            bool skip = !texture || !texture->isCreated();
+
+            GLuint* binding = skip ? nullptr : getBinding(unit, texture->getTarget());
+            bool bound = binding && *binding == texture->getHandle();
+
+            if (!multiBind && !skip)
+            {
+                bind(unit, texture->getTarget(), texture->getHandle());
+                continue;
+            }
+
+            if (!skip && !bound)
+            {
+                if (run.empty())
+                    runFirst = unit;
+
+                run.push_back(texture->getHandle());
+                if (binding)
+                    *binding = texture->getHandle();
+                continue;
+            }
+
+            if (bound)
+                _statistics.elided += 2;
+
+            if (!run.empty())
+            {
+                Extensions::glBindTextures(runFirst, (GLsizei) run.size(), run.data());
+                _statistics.issued++;
+                _statistics.elided += 2 * run.size() - 1;
+                run.clear();
+            }
+        }
+    }
+
+    void TextureBindingCache::setMultiBindEnabled(bool enabled)
+    {
+        _multiBindEnabled = enabled;
+    }
+
+    bool TextureBindingCache::isMultiBindEnabled() const
+    {
+        return _multiBindEnabled;
+    }
+
+    void TextureBindingCache::onDelete(GLuint texture)
+    {
+        for (Unit& unit : _units)
+        {
+            for (GLuint& binding : unit.textures)
+            {
+                if (binding == texture)
+                    binding = 0;
+            }
+        }
+    }
+
+    void TextureBindingCache::invalidate()
+    {
+        for (Unit& unit : _units)
+            std::fill(unit.textures, unit.textures + TARGET_COUNT, UNKNOWN);
+
+        _activeUnit = UNKNOWN;
+    }
+
+    const TextureBindingStatistics& TextureBindingCache::getStatistics() const
+    {
+        return _statistics;
+    }
+
+    void TextureBindingCache::resetStatistics()
+    {
+        _statistics = TextureBindingStatistics();
+    }
+
+    // Returns the shadowed binding of a target, or nullptr for targets that are not tracked
+    GLuint* TextureBindingCache::getBinding(GLuint unit, GLenum target)
+    {
+        int index = getTargetIndex(target);
+        if (index < 0)
+            return nullptr;
+
+        if (unit >= _units.size())
+        {
+            Unit unknown;
+            std::fill(unknown.textures, unknown.textures + TARGET_COUNT, UNKNOWN);
+            _units.resize(unit + 1, unknown);
+        }
+
+        return &_units[unit].textures[index];
+    }
+
+    void TextureBindingCache::setActiveUnit(GLuint unit)
+    {
+        if (_activeUnit == unit)
+        {
+            _statistics.elided++;
+            return;
+        }
+
+        glActiveTexture(GL_TEXTURE0 + unit);
+        _activeUnit = unit;
+        _statistics.issued++;
+    }
+#ifdef GDT_NAMESPACE
+}
+#endif
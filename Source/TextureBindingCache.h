@@ -0,0 +1,97 @@
+#pragma once
+
+#include "OpenGL.h"
+
+#include <cstddef>
+#include <vector>
+
+#ifdef GDT_NAMESPACE
+namespace GDT
+{
+#endif
+    class Texture;
+
+    /**
+     * Counts of the GL calls made by a TextureBindingCache and of the calls
+     * a plain glActiveTexture and glBindTexture per bind would have made on
+     * top of those
+     */
+    struct TextureBindingStatistics
+    {
+        size_t issued;
+        size_t elided;
+    };
+
+    /**
+     * Shadows the texture bindings of a GL context, so binding a texture
+     * that is already bound, or selecting the unit that is already active,
+     * makes no GL call. While a cache is current on a thread, Texture::bind,
+     * Texture::release and the texture classes go through it.
+     *
+     * The bindings start out unknown. Call invalidate() after binding
+     * textures outside of the cache, or after code that might have.
+     */
+    class TextureBindingCache
+    {
+    public:
+        TextureBindingCache();
+
+        /**
+         * Makes the cache track the context current on the calling thread,
+         * one cache is needed per context
+         *
+         * @param cache The cache to use, or nullptr to bind textures directly
+         */
+        static void makeCurrent(TextureBindingCache* cache);
+        static TextureBindingCache* getCurrent();
+
+        /* Binds a texture, or 0, to a target of a texture unit */
+        void bind(GLuint unit, GLenum target, GLuint texture);
+
+        /* Binds a texture, or 0, to a target of the active texture unit */
+        void bindActive(GLenum target, GLuint texture);
+
+        /**
+         * Binds textures to consecutive units starting at first, leaving
+         * units with a nullptr or a texture that was not created as they
+         * are. The changed bindings are made with one glBindTextures call
+         * per run of consecutive units if multi-bind is available and
+         * enabled. Multi-bind leaves the active texture unit alone.
+         */
+        void bindTextures(GLuint first, const std::vector<const Texture*>& textures);
+
+        /* Whether bindTextures may use glBindTextures, on by default when available */
+        void setMultiBindEnabled(bool enabled);
+        bool isMultiBindEnabled() const;
+
+        /* Forgets the bindings of a texture that is deleted, which the GL unbinds from every unit */
+        void onDelete(GLuint texture);
+
+        /* Marks every binding and the active unit unknown, so the next binds go through */
+        void invalidate();
+
+        const TextureBindingStatistics& getStatistics() const;
+        void resetStatistics();
+
+    private:
+        // Number of texture targets whose bindings are tracked
+        static const size_t TARGET_COUNT = 11;
+
+        // Binding of every tracked target of one texture unit
+        struct Unit
+        {
+            GLuint textures[TARGET_COUNT];
+        };
+
+        GLuint* getBinding(GLuint unit, GLenum target);
+        void setActiveUnit(GLuint unit);
+
+        std::vector<Unit> _units;
+        GLuint _activeUnit;
+        bool _multiBindEnabled;
+
+        TextureBindingStatistics _statistics;
+    };
+#ifdef GDT_NAMESPACE
+}
+#endif
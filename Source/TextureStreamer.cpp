@@ -0,0 +1,370 @@
+#include "TextureStreamer.h"
+
+#include "Extensions.h"
+#include "TextureBindingCache.h"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+
+#ifdef GDT_NAMESPACE
+namespace GDT
+{
+#endif
+    namespace
+    {
+        const GLbitfield PERSISTENT_MAP_FLAGS = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    }
+
+    TextureStreamer::TextureStreamer() :
+        _isCreated(false),
+        _isPersistent(false),
+        _bufferSize(0),
+        _frameBudget(0),
+        _sequence(0),
+        _uploadedBytes(0),
+        _failedCount(0),
+        _stopping(false)
+    {
+
+    }
+
+    TextureStreamer::~TextureStreamer()
+    {
+        // The buffers are GL objects and freed by destroy(), but the workers must not outlive the streamer
+        stopWorkers();
+    }
+
+    void TextureStreamer::create(size_t bufferSize, unsigned int bufferCount, unsigned int workerCount)
+    {
+        if (_isCreated)
+            destroy();
+
+        _bufferSize = bufferSize;
+        _isPersistent = Extensions::hasBufferStorage();
+        _uploadedBytes = 0;
+        _failedCount = 0;
+
+        _slots.resize(std::max(bufferCount, 1u));
+        for (Slot& slot : _slots)
+        {
+            slot.mapped = nullptr;
+            slot.fence = nullptr;
+            slot.state = SlotState::FREE;
+            slot.decoded = false;
+
+            glGenBuffers(1, &slot.buffer);
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, slot.buffer);
+
+            if (_isPersistent)
+            {
+                Extensions::glBufferStorage(GL_PIXEL_UNPACK_BUFFER, bufferSize, nullptr, PERSISTENT_MAP_FLAGS);
+                slot.mapped = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, bufferSize, PERSISTENT_MAP_FLAGS);
+            }
+            else
+            {
+                glBufferData(GL_PIXEL_UNPACK_BUFFER, bufferSize, nullptr, GL_STREAM_DRAW);
+            }
+        }
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+        _stopping = false;
+        for (unsigned int i = 0; i < std::max(workerCount, 1u); i++)
+            _workers.emplace_back(&TextureStreamer::run, this);
+
+        _isCreated = true;
+    }
+
+    void TextureStreamer::destroy()
+    {
+        if (!_isCreated) return;
+
+        stopWorkers();
+
+        for (Slot& slot : _slots)
+        {
+            if (slot.fence)
+                glDeleteSync(slot.fence);
+
+            if (slot.mapped)
+            {
+                glBindBuffer(GL_PIXEL_UNPACK_BUFFER, slot.buffer);
+                glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+            }
+
+            glDeleteBuffers(1, &slot.buffer);
+        }
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+        _slots.clear();
+        _queue.clear();
+        _decodeQueue.clear();
+        _decoded.clear();
+        _isCreated = false;
+    }
+
+    void TextureStreamer::setFrameBudget(size_t bytes)
+    {
+        _frameBudget = bytes;
+    }
+
+    void TextureStreamer::upload(Texture2D& texture, uint level, uint x, uint y, uint width, uint height,
+        GLenum format, GLenum type, size_t size, Decoder decode)
+    {
+        if (size > _bufferSize)
+            throw std::invalid_argument("Texture upload of " + std::to_string(size) + " bytes does not fit in the streaming buffers");
+
+        _queue.push_back(Job{ &texture, level, x, y, width, height, format, type, size, decode, _sequence++ });
+    }
+
+    void TextureStreamer::upload(Texture2D& texture, uint level, uint x, uint y, uint width, uint height,
+        GLenum format, GLenum type, std::vector<unsigned char> pixels)
+    {
+        size_t size = pixels.size();
+
+        // std::function has to be copyable, so the pixels are shared rather than moved into it
+        std::shared_ptr<std::vector<unsigned char>> data = std::make_shared<std::vector<unsigned char>>(std::move(pixels));
+
+        upload(texture, level, x, y, width, height, format, type, size, [data](void* destination, size_t size)
+        {
+            memcpy(destination, data->data(), size);
+            return true;
+        });
+    }
+
+    void TextureStreamer::update()
+    {
+        _uploadedBytes = 0;
+        if (!_isCreated) return;
+
+        retireFences();
+        issueUploads();
+        assignJobs();
+    }
+
+    bool TextureStreamer::isCreated() const
+    {
+        return _isCreated;
+    }
+
+    bool TextureStreamer::isIdle() const
+    {
+        return getPendingCount() == 0;
+    }
+
+    size_t TextureStreamer::getPendingCount() const
+    {
+        size_t count = _queue.size();
+        for (const Slot& slot : _slots)
+        {
+            if (slot.state == SlotState::DECODING || slot.state == SlotState::READY)
+                count++;
+        }
+        return count;
+    }
+
+    size_t TextureStreamer::getUploadedBytes() const
+    {
+        return _uploadedBytes;
+    }
+
+    size_t TextureStreamer::getFailedCount() const
+    {
+        return _failedCount;
+    }
+
+    size_t TextureStreamer::getBufferSize() const
+    {
+        return _bufferSize;
+    }
+
+    bool TextureStreamer::isPersistent() const
+    {
+        return _isPersistent;
+    }
+
+    void TextureStreamer::run()
+    {
+        while (true)
+        {
+            size_t index;
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _workAvailable.wait(lock, [this]() { return _stopping || !_decodeQueue.empty(); });
+                if (_stopping)
+                    return;
+
+                index = _decodeQueue.front();
+                _decodeQueue.pop_front();
+            }
+
+            // The render thread leaves a slot alone until it is reported decoded
+            Slot& slot = _slots[index];
+            bool decoded;
+            try
+            {
+                decoded = slot.mapped && slot.job.decode(slot.mapped, slot.job.size);
+            }
+            catch (const std::exception&)
+            {
+                decoded = false;
+            }
+
+            std::lock_guard<std::mutex> lock(_mutex);
+            slot.decoded = decoded;
+            _decoded.push_back(index);
+        }
+    }
+
+    void TextureStreamer::stopWorkers()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stopping = true;
+        }
+        _workAvailable.notify_all();
+
+        for (std::thread& worker : _workers)
+            worker.join();
+        _workers.clear();
+    }
+
+    // Frees the buffers the GPU has finished reading from, without waiting
+    void TextureStreamer::retireFences()
+    {
+        for (Slot& slot : _slots)
+        {
+            if (slot.state != SlotState::IN_FLIGHT)
+                continue;
+
+            GLenum result = glClientWaitSync(slot.fence, 0, 0);
+            if (result == GL_TIMEOUT_EXPIRED)
+                continue;
+
+            glDeleteSync(slot.fence);
+            slot.fence = nullptr;
+            slot.state = SlotState::FREE;
+        }
+    }
+
+    void TextureStreamer::issueUploads()
+    {
+        std::vector<size_t> decoded;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            decoded.swap(_decoded);
+        }
+
+        for (size_t index : decoded)
+            _slots[index].state = SlotState::READY;
+
+        // Workers finish out of order, upload in the order the uploads were queued
+        std::vector<size_t> ready;
+        for (size_t i = 0; i < _slots.size(); i++)
+        {
+            if (_slots[i].state == SlotState::READY)
+                ready.push_back(i);
+        }
+        std::sort(ready.begin(), ready.end(), [this](size_t a, size_t b) { return _slots[a].job.sequence < _slots[b].job.sequence; });
+
+        // An upload still being decoded holds back every later one, which could otherwise be overwritten by it
+        uint64_t firstPending = _queue.empty() ? UINT64_MAX : _queue.front().sequence;
+        for (const Slot& slot : _slots)
+        {
+            if (slot.state == SlotState::DECODING)
+                firstPending = std::min(firstPending, slot.job.sequence);
+        }
+
+        for (size_t index : ready)
+        {
+            Slot& slot = _slots[index];
+
+            if (slot.job.sequence > firstPending)
+                break;
+
+            if (_frameBudget > 0 && _uploadedBytes > 0 && _uploadedBytes + slot.job.size > _frameBudget)
+                break;
+
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, slot.buffer);
+            if (!_isPersistent)
+            {
+                glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+                slot.mapped = nullptr;
+            }
+
+            if (!slot.decoded)
+            {
+                _failedCount++;
+                slot.state = SlotState::FREE;
+                slot.job.decode = nullptr;
+                continue;
+            }
+
+            const Job& job = slot.job;
+            if (TextureBindingCache* cache = TextureBindingCache::getCurrent())
+                cache->bindActive(GL_TEXTURE_2D, job.texture->getHandle());
+            else
+                glBindTexture(GL_TEXTURE_2D, job.texture->getHandle());
+            try
+            {
+                // Pixels are tightly packed, with the buffer bound the data pointer is an offset into it
+                job.texture->setSubData(job.level, job.x, job.y, job.width, job.height, job.format, job.type, nullptr, 0, 1);
+            }
+            catch (const std::out_of_range&)
+            {
+                // The texture storage changed since the upload was queued, drop it rather than retrying every frame
+                _failedCount++;
+                slot.state = SlotState::FREE;
+                slot.job.decode = nullptr;
+                continue;
+            }
+
+            slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+            slot.state = SlotState::IN_FLIGHT;
+            slot.job.decode = nullptr;
+            _uploadedBytes += job.size;
+        }
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    }
+
+    // Hands free buffers to the workers along with the next queued uploads
+    void TextureStreamer::assignJobs()
+    {
+        std::vector<size_t> assigned;
+        for (size_t i = 0; i < _slots.size() && !_queue.empty(); i++)
+        {
+            Slot& slot = _slots[i];
+            if (slot.state != SlotState::FREE)
+                continue;
+
+            if (!_isPersistent)
+            {
+                // The buffer's fence has passed, so nothing reads the old contents anymore
+                glBindBuffer(GL_PIXEL_UNPACK_BUFFER, slot.buffer);
+                slot.mapped = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, _bufferSize,
+                    GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+            }
+
+            slot.job = _queue.front();
+            _queue.pop_front();
+            slot.decoded = false;
+            slot.state = SlotState::DECODING;
+            assigned.push_back(i);
+        }
+
+        if (!_isPersistent)
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+        if (assigned.empty())
+            return;
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _decodeQueue.insert(_decodeQueue.end(), assigned.begin(), assigned.end());
+        }
+        _workAvailable.notify_all();
+    }
+#ifdef GDT_NAMESPACE
+}
+#endif
@@ -0,0 +1,173 @@
+#pragma once
+
+#include "Texture.h"
+
+#include "OpenGL.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#ifdef GDT_NAMESPACE
+namespace GDT
+{
+#endif
+    /**
+     * Uploads texture data without stalling the render thread. Every upload
+     * gets a pixel buffer object from a pool, worker threads decode or copy
+     * the pixels into the mapped buffer, and update() then issues the
+     * glTexSubImage2D from the buffer. A fence guards each buffer until the
+     * GPU has read it. update() uploads at most a budget of bytes per
+     * frame, so streaming a large set of textures is spread over several
+     * frames instead of causing a spike.
+     *
+     * With GL 4.4 or GL_ARB_buffer_storage the buffers are mapped once,
+     * persistently. Otherwise they are mapped while the workers fill them.
+     */
+    class TextureStreamer
+    {
+    public:
+        /**
+         * Writes the tightly packed pixels of an upload to the given memory,
+         * called on a worker thread
+         *
+         * @return false if the pixels could not be produced, the upload is then dropped
+         */
+        typedef std::function<bool(void* pixels, size_t size)> Decoder;
+
+        TextureStreamer();
+        ~TextureStreamer();
+
+        TextureStreamer(const TextureStreamer&) = delete;
+        TextureStreamer& operator=(const TextureStreamer&) = delete;
+
+        /**
+         * Creates the buffer pool and starts the workers
+         *
+         * @param bufferSize  The size of every buffer, the largest upload that fits
+         * @param bufferCount The number of buffers, more than workers so decoding overlaps with uploading
+         * @param workerCount The number of decoding threads
+         */
+        void create(size_t bufferSize, unsigned int bufferCount = 4, unsigned int workerCount = 2);
+
+        /* Stops the workers, dropping uploads that were not issued, and frees the buffers */
+        void destroy();
+
+        /**
+         * Limits the bytes uploaded by a single update(), 0 for no limit.
+         * At least one upload is issued per update regardless.
+         */
+        void setFrameBudget(size_t bytes);
+
+        /**
+         * Queues an upload of a region of a texture level. The texture must
+         * have storage for the region and outlive the upload.
+         * Throws std::invalid_argument if size exceeds the buffer size.
+         *
+         * @param texture The texture to upload to
+         * @param level   The mip level to update
+         * @param x       The left edge of the region
+         * @param y       The bottom edge of the region
+         * @param width   The width of the region
+         * @param height  The height of the region
+         * @param format  The format of the decoded pixels
+         * @param type    The type of the decoded pixels
+         * @param size    The size of the decoded pixels in bytes, rows are not padded
+         * @param decode  Produces the pixels on a worker thread
+         */
+        void upload(Texture2D& texture, uint level, uint x, uint y, uint width, uint height,
+            GLenum format, GLenum type, size_t size, Decoder decode);
+
+        /* Queues an upload of pixels already in memory, which are copied on a worker thread */
+        void upload(Texture2D& texture, uint level, uint x, uint y, uint width, uint height,
+            GLenum format, GLenum type, std::vector<unsigned char> pixels);
+
+        /**
+         * Issues the uploads of decoded pixels within the frame budget and
+         * hands free buffers to the workers. Call it on the render thread
+         * once per frame. It binds the textures it uploads to on the active
+         * texture unit.
+         */
+        void update();
+
+        bool isCreated() const;
+
+        /* Whether every queued upload has been issued */
+        bool isIdle() const;
+
+        /* Number of uploads that were queued and have not been issued yet */
+        size_t getPendingCount() const;
+
+        /* Bytes uploaded by the last update() */
+        size_t getUploadedBytes() const;
+
+        /* Number of uploads dropped because their decoder failed or the texture no longer has storage for them */
+        size_t getFailedCount() const;
+
+        size_t getBufferSize() const;
+        bool isPersistent() const;
+
+    private:
+        struct Job
+        {
+            Texture2D* texture;
+            uint level, x, y, width, height;
+            GLenum format, type;
+            size_t size;
+            Decoder decode;
+            uint64_t sequence;
+        };
+
+        enum class SlotState
+        {
+            FREE,
+            DECODING,
+            READY,
+            IN_FLIGHT
+        };
+
+        struct Slot
+        {
+            GLuint buffer;
+            void* mapped;
+            GLsync fence;
+            SlotState state;
+            bool decoded;
+            Job job;
+        };
+
+        void run();
+        void stopWorkers();
+        void retireFences();
+        void issueUploads();
+        void assignJobs();
+
+        bool _isCreated;
+        bool _isPersistent;
+        size_t _bufferSize;
+        size_t _frameBudget;
+
+        std::vector<Slot> _slots;
+        std::deque<Job> _queue;
+        uint64_t _sequence;
+
+        size_t _uploadedBytes;
+        size_t _failedCount;
+
+        // Shared with the workers
+        std::mutex _mutex;
+        std::condition_variable _workAvailable;
+        std::deque<size_t> _decodeQueue;
+        std::vector<size_t> _decoded;
+        bool _stopping;
+
+        std::vector<std::thread> _workers;
+    };
+#ifdef GDT_NAMESPACE
+}
+#endif
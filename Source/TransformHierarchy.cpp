@@ -0,0 +1,181 @@
+#include "TransformHierarchy.h"
+
+#include "Parallel.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+#ifdef GDT_NAMESPACE
+namespace GDT
+{
+#endif
+    namespace
+    {
+        // Minimum number of nodes updated per thread
+        const size_t UPDATE_GRAIN_SIZE = 1 << 15;
+    }
+
+    const size_t TransformHierarchy::NO_PARENT = (size_t) -1;
+
+    TransformHierarchy::TransformHierarchy()
+    {
+
+    }
+
+    size_t TransformHierarchy::addNode(size_t parent)
+    {
+        size_t node = _parents.size();
+
+        if (parent == NO_PARENT)
+        {
+            _segments.push_back(node);
+        }
+        else
+        {
+            if (parent >= node)
+            {
+                throw std::out_of_range(std::string("Attempting to add a child to node ") + std::to_string(parent) + std::string(" of a TransformHierarchy with ") + std::to_string(node) + std::string(" nodes."));
+            }
+
+            // Segments starting after the parent no longer stand on their own
+            while (_segments.back() > parent)
+                _segments.pop_back();
+        }
+
+        _parents.push_back(parent);
+        _translations.push_back(Vector3f(0));
+        _rotations.push_back(Quaternionf::IDENTITY);
+        _scales.push_back(Vector3f(1));
+        _worldMatrices.push_back(Matrix4f::IDENTITY);
+        _dirty.push_back(1);
+        _changed.push_back(0);
+
+        return node;
+    }
+
+    void TransformHierarchy::reserve(size_t count)
+    {
+        _parents.reserve(count);
+        _translations.reserve(count);
+        _rotations.reserve(count);
+        _scales.reserve(count);
+        _worldMatrices.reserve(count);
+        _dirty.reserve(count);
+        _changed.reserve(count);
+    }
+
+    void TransformHierarchy::clear()
+    {
+        _parents.clear();
+        _translations.clear();
+        _rotations.clear();
+        _scales.clear();
+        _worldMatrices.clear();
+        _dirty.clear();
+        _changed.clear();
+        _segments.clear();
+    }
+
+    size_t TransformHierarchy::size() const
+    {
+        return _parents.size();
+    }
+
+    size_t TransformHierarchy::getParent(size_t node) const
+    {
+        return _parents[node];
+    }
+
+    void TransformHierarchy::setTranslation(size_t node, const Vector3f& translation)
+    {
+        _translations[node] = translation;
+        _dirty[node] = 1;
+    }
+
+    void TransformHierarchy::setRotation(size_t node, const Quaternionf& rotation)
+    {
+        _rotations[node] = rotation;
+        _dirty[node] = 1;
+    }
+
+    void TransformHierarchy::setScale(size_t node, const Vector3f& scale)
+    {
+        _scales[node] = scale;
+        _dirty[node] = 1;
+    }
+
+    void TransformHierarchy::setLocal(size_t node, const Vector3f& translation, const Quaternionf& rotation, const Vector3f& scale)
+    {
+        _translations[node] = translation;
+        _rotations[node] = rotation;
+        _scales[node] = scale;
+        _dirty[node] = 1;
+    }
+
+    const Vector3f& TransformHierarchy::getTranslation(size_t node) const
+    {
+        return _translations[node];
+    }
+
+    const Quaternionf& TransformHierarchy::getRotation(size_t node) const
+    {
+        return _rotations[node];
+    }
+
+    const Vector3f& TransformHierarchy::getScale(size_t node) const
+    {
+        return _scales[node];
+    }
+
+    void TransformHierarchy::update()
+    {
+        size_t count = size();
+
+        Parallel::forRange(count, UPDATE_GRAIN_SIZE, [this, count](size_t begin, size_t end) {
+            // Move both ends forward to the next segment start, so every subtree is updated by one thread
+            std::vector<size_t>::const_iterator first = std::lower_bound(_segments.begin(), _segments.end(), begin);
+            std::vector<size_t>::const_iterator last = std::lower_bound(_segments.begin(), _segments.end(), end);
+
+            updateRange(first != _segments.end() ? *first : count, last != _segments.end() ? *last : count);
+        });
+    }
+
+    void TransformHierarchy::updateRange(size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; i++)
+        {
+            size_t parent = _parents[i];
+            bool parentChanged = parent != NO_PARENT && _changed[parent];
+
+            if (!_dirty[i] && !parentChanged)
+            {
+                _changed[i] = 0;
+                continue;
+            }
+
+            Matrix4f local = compose(_translations[i], _rotations[i], _scales[i]);
+            _worldMatrices[i] = parent == NO_PARENT ? local : _worldMatrices[parent] * local;
+
+            _dirty[i] = 0;
+            _changed[i] = 1;
+        }
+    }
+
+    const Matrix4f& TransformHierarchy::getWorldMatrix(size_t node) const
+    {
+        return _worldMatrices[node];
+    }
+
+    const Matrix4f* TransformHierarchy::getWorldMatrices() const
+    {
+        return _worldMatrices.data();
+    }
+
+    bool TransformHierarchy::hasChanged(size_t node) const
+    {
+        return _changed[node] != 0;
+    }
+#ifdef GDT_NAMESPACE
+}
+#endif
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "Vector3f.h"
+#include "Matrix4f.h"
+#include "Quaternionf.h"
+
+#include <cstddef>
+#include <vector>
+
+#ifdef GDT_NAMESPACE
+namespace GDT
+{
+#endif
+    /**
+     * Scene graph of local translation, rotation and scale transforms with
+     * cached world matrices. Nodes are stored in flat arrays sorted so that
+     * every parent comes before its children, which lets update() refresh
+     * all world matrices in a single linear pass. Only nodes whose local
+     * transform changed, and their descendants, are recomputed.
+     */
+    class TransformHierarchy
+    {
+    public:
+        static const size_t NO_PARENT;
+
+        TransformHierarchy();
+
+        /**
+         * Adds a node with an identity local transform
+         *
+         * @param parent The index of an existing node, or NO_PARENT to add a root
+         * @return the index of the new node
+         */
+        size_t addNode(size_t parent = NO_PARENT);
+
+        void reserve(size_t count);
+        void clear();
+        size_t size() const;
+        size_t getParent(size_t node) const;
+
+        /* Local transform, relative to the parent */
+        void setTranslation(size_t node, const Vector3f& translation);
+        void setRotation(size_t node, const Quaternionf& rotation);
+        void setScale(size_t node, const Vector3f& scale);
+        void setLocal(size_t node, const Vector3f& translation, const Quaternionf& rotation, const Vector3f& scale);
+
+        const Vector3f& getTranslation(size_t node) const;
+        const Quaternionf& getRotation(size_t node) const;
+        const Vector3f& getScale(size_t node) const;
+
+        /**
+         * Recomputes the world matrices of all nodes whose local transform
+         * changed since the last update, and of their descendants. Large
+         * hierarchies are split across threads at boundaries between
+         * independent root subtrees.
+         */
+        void update();
+
+        /* World matrices as of the last update, contiguous in node order for bulk uploads */
+        const Matrix4f& getWorldMatrix(size_t node) const;
+        const Matrix4f* getWorldMatrices() const;
+
+        /* Whether the world matrix of the node was recomputed by the last update */
+        bool hasChanged(size_t node) const;
+
+    private:
+        void updateRange(size_t begin, size_t end);
+
+        std::vector<size_t> _parents;
+        std::vector<Vector3f> _translations;
+        std::vector<Quaternionf> _rotations;
+        std::vector<Vector3f> _scales;
+        std::vector<Matrix4f> _worldMatrices;
+
+        // Bytes rather than std::vector<bool>, so threads can write neighbouring flags
+        std::vector<unsigned char> _dirty;
+        std::vector<unsigned char> _changed;
+
+        // Ascending indices at which no later node has a parent before them,
+        // every range between two consecutive ones can be updated independently
+        std::vector<size_t> _segments;
+    };
+#ifdef GDT_NAMESPACE
+}
+#endif
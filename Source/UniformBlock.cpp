@@ -0,0 +1,221 @@
+#include "UniformBlock.h"
+
+#include "Shader.h"
+#include "Buffer.h"
+#include "Vector2f.h"
+#include "Vector3f.h"
+#include "Vector4f.h"
+#include "Matrix4f.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+#ifdef GDT_NAMESPACE
+namespace GDT
+{
+#endif
+    namespace
+    {
+        // Size of one column and the number of columns of a type that can be a block member, false for other types
+        bool getTypeLayout(GLenum type, size_t& columnSize, int& columns)
+        {
+            int rows;
+            switch (type)
+            {
+            case GL_FLOAT: case GL_INT: case GL_UNSIGNED_INT: case GL_BOOL: rows = 1; columns = 1; break;
+            case GL_FLOAT_VEC2: case GL_INT_VEC2: case GL_UNSIGNED_INT_VEC2: case GL_BOOL_VEC2: rows = 2; columns = 1; break;
+            case GL_FLOAT_VEC3: case GL_INT_VEC3: case GL_UNSIGNED_INT_VEC3: case GL_BOOL_VEC3: rows = 3; columns = 1; break;
+            case GL_FLOAT_VEC4: case GL_INT_VEC4: case GL_UNSIGNED_INT_VEC4: case GL_BOOL_VEC4: rows = 4; columns = 1; break;
+            case GL_FLOAT_MAT2: rows = 2; columns = 2; break;
+            case GL_FLOAT_MAT3: rows = 3; columns = 3; break;
+            case GL_FLOAT_MAT4: rows = 4; columns = 4; break;
+            case GL_FLOAT_MAT2x3: rows = 3; columns = 2; break;
+            case GL_FLOAT_MAT2x4: rows = 4; columns = 2; break;
+            case GL_FLOAT_MAT3x2: rows = 2; columns = 3; break;
+            case GL_FLOAT_MAT3x4: rows = 4; columns = 3; break;
+            case GL_FLOAT_MAT4x2: rows = 2; columns = 4; break;
+            case GL_FLOAT_MAT4x3: rows = 3; columns = 4; break;
+            default: return false;
+            }
+
+            // Every component of these types is 4 bytes
+            columnSize = rows * sizeof(float);
+            return true;
+        }
+    }
+
+    UniformBlock::UniformBlock() :
+        _binding(0)
+    {
+
+    }
+
+    bool UniformBlock::init(const ShaderProgram& program, const char* blockName)
+    {
+        _members.clear();
+        _data.clear();
+        _binding = 0;
+
+        const ProgramReflection& reflection = program.getReflection();
+
+        int block = reflection.find(ProgramInterface::UNIFORM_BLOCK, blockName);
+        if (block < 0)
+            return false;
+
+        _binding = (GLuint) reflection[block].location;
+        _data.assign(reflection[block].dataSize, 0);
+
+        for (const ProgramResource& resource : reflection.getResources())
+        {
+            if (resource.interface != ProgramInterface::UNIFORM || resource.blockIndex != block)
+                continue;
+
+            Member member = { reflection.getName(resource), resource.type, resource.offset,
+                resource.arraySize, resource.arrayStride, resource.matrixStride, resource.rowMajor == 1 };
+            _members.push_back(member);
+        }
+        return true;
+    }
+
+    int UniformBlock::getMember(const char* name) const
+    {
+        size_t length = strlen(name);
+        for (size_t i = 0; i < _members.size(); i++)
+        {
+            const std::string& memberName = _members[i].name;
+            if (memberName == name)
+                return (int) i;
+
+            // Arrays are reported by their first element
+            if (memberName.size() == length + 3 && memberName.compare(0, length, name) == 0 && memberName.compare(length, 3, "[0]") == 0)
+                return (int) i;
+        }
+        return -1;
+    }
+
+    void UniformBlock::set(int member, float value, int element)
+    {
+        write(member, element, &value, sizeof(value), 1);
+    }
+
+    void UniformBlock::set(int member, int value, int element)
+    {
+        write(member, element, &value, sizeof(value), 1);
+    }
+
+    void UniformBlock::set(int member, const Vector2f& v, int element)
+    {
+        write(member, element, &v, sizeof(Vector2f), 1);
+    }
+
+    void UniformBlock::set(int member, const Vector3f& v, int element)
+    {
+        write(member, element, &v, sizeof(Vector3f), 1);
+    }
+
+    void UniformBlock::set(int member, const Vector4f& v, int element)
+    {
+        write(member, element, v.a, sizeof(v.a), 1);
+    }
+
+    void UniformBlock::set(int member, const Matrix4f& m, int element)
+    {
+        write(member, element, m.toArray(), 4 * sizeof(float), 4);
+    }
+
+    void UniformBlock::setArray(int member, const float* values, int count)
+    {
+        for (int i = 0; i < count; i++)
+            write(member, i, &values[i], sizeof(float), 1);
+    }
+
+    void UniformBlock::setArray(int member, const Vector4f* values, int count)
+    {
+        for (int i = 0; i < count; i++)
+            write(member, i, values[i].a, sizeof(values[i].a), 1);
+    }
+
+    void UniformBlock::setArray(int member, const Matrix4f* values, int count)
+    {
+        for (int i = 0; i < count; i++)
+            write(member, i, values[i].toArray(), 4 * sizeof(float), 4);
+    }
+
+    void UniformBlock::upload(UniformBuffer& buffer) const
+    {
+        if (buffer.getSize() < _data.size())
+            buffer.setData(_data.size(), _data.data());
+        else
+            buffer.setSubData(0, _data.size(), _data.data());
+
+        buffer.bindBase(_binding);
+    }
+
+    RingBuffer::Allocation UniformBlock::upload(RingBuffer& ring) const
+    {
+        RingBuffer::Allocation allocation = ring.allocate(_data.size());
+        memcpy(allocation.data, _data.data(), _data.size());
+
+        ring.bindRange(_binding, allocation);
+        return allocation;
+    }
+
+    const unsigned char* UniformBlock::getData() const
+    {
+        return _data.data();
+    }
+
+    size_t UniformBlock::getSize() const
+    {
+        return _data.size();
+    }
+
+    GLuint UniformBlock::getBinding() const
+    {
+        return _binding;
+    }
+
+    void UniformBlock::write(int member, int element, const void* data, size_t columnSize, int columns)
+    {
+        if (member < 0 || member >= (int) _members.size())
+            throw std::out_of_range("Invalid uniform block member");
+
+        const Member& m = _members[member];
+        if (element < 0 || element >= m.arraySize)
+            throw std::out_of_range("Uniform block array element out of range: " + m.name);
+
+        size_t memberColumnSize;
+        int memberColumns;
+        if (!getTypeLayout(m.type, memberColumnSize, memberColumns) || memberColumnSize != columnSize || memberColumns != columns)
+            throw std::invalid_argument("Value does not match the type of uniform block member: " + m.name);
+
+        // Row major matrices are stored as the rows of the value, each one component of every column
+        bool transpose = m.rowMajor && columns > 1;
+        int vectors = columns, components = (int) (columnSize / sizeof(float));
+        if (transpose)
+            std::swap(vectors, components);
+
+        size_t offset = m.offset + (size_t) element * (m.arrayStride > 0 ? m.arrayStride : 0);
+        size_t vectorSize = components * sizeof(float);
+        size_t vectorStride = m.matrixStride > 0 ? m.matrixStride : vectorSize;
+        if (offset + (vectors - 1) * vectorStride + vectorSize > _data.size())
+            throw std::out_of_range("Uniform block member exceeds the block: " + m.name);
+
+        const unsigned char* source = static_cast<const unsigned char*>(data);
+        if (!transpose)
+        {
+            for (int c = 0; c < columns; c++)
+                memcpy(&_data[offset + c * vectorStride], source + c * columnSize, columnSize);
+            return;
+        }
+
+        for (int r = 0; r < vectors; r++)
+        {
+            for (int c = 0; c < columns; c++)
+                memcpy(&_data[offset + r * vectorStride + c * sizeof(float)], source + c * columnSize + r * sizeof(float), sizeof(float));
+        }
+    }
+#ifdef GDT_NAMESPACE
+}
+#endif
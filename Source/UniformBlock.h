@@ -0,0 +1,95 @@
+#pragma once
+
+#include "OpenGL.h"
+#include "RingBuffer.h"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#ifdef GDT_NAMESPACE
+namespace GDT
+{
+#endif
+    class ShaderProgram;
+    class UniformBuffer;
+    class Vector2f;
+    class Vector3f;
+    class Vector4f;
+    class Matrix4f;
+
+    /**
+     * CPU copy of a uniform block of a program. Members are written at the
+     * offsets and strides the program reports, whatever the layout of the
+     * block, and the whole block is uploaded and bound in one call instead
+     * of one glUniform call per value.
+     */
+    class UniformBlock
+    {
+    public:
+        UniformBlock();
+
+        /**
+         * Lays out the block as the given program reports it
+         *
+         * @param program   A built program
+         * @param blockName The name of the uniform block in the shaders
+         * @return false if the program has no active block of that name
+         */
+        bool init(const ShaderProgram& program, const char* blockName);
+
+        /**
+         * Looks up a member, meant to be done once rather than every frame
+         *
+         * @param name The name as reported by the GL, e.g. "Lights.color", arrays may leave out "[0]"
+         * @return the index to pass to the setters, or -1 if the block has no such member
+         */
+        int getMember(const char* name) const;
+
+        /**
+         * Setters for a member, or an element of an array member. Throw a std::out_of_range for invalid
+         * members and elements, and a std::invalid_argument if the value does not have the size of the member type.
+         */
+        void set(int member, float value, int element = 0);
+        void set(int member, int value, int element = 0);
+        void set(int member, const Vector2f& v, int element = 0);
+        void set(int member, const Vector3f& v, int element = 0);
+        void set(int member, const Vector4f& v, int element = 0);
+        void set(int member, const Matrix4f& m, int element = 0);
+
+        void setArray(int member, const float* values, int count);
+        void setArray(int member, const Vector4f* values, int count);
+        void setArray(int member, const Matrix4f* values, int count);
+
+        /* Copies the block into the buffer and binds it to the binding point of the block */
+        void upload(UniformBuffer& buffer) const;
+
+        /* Copies the block into a range of the ring buffer and binds that range to the binding point of the block */
+        RingBuffer::Allocation upload(RingBuffer& ring) const;
+
+        const unsigned char* getData() const;
+        size_t getSize() const;
+        GLuint getBinding() const;
+
+    private:
+        struct Member
+        {
+            std::string name;
+            GLenum type;
+            GLint offset;
+            GLint arraySize;
+            GLint arrayStride;
+            GLint matrixStride;
+            bool rowMajor;
+        };
+
+        /* Writes a column major value of the member type, row major matrices are stored transposed with rows matrixStride apart */
+        void write(int member, int element, const void* data, size_t columnSize, int columns);
+
+        std::vector<Member> _members;
+        std::vector<unsigned char> _data;
+        GLuint _binding;
+    };
+#ifdef GDT_NAMESPACE
+}
+#endif
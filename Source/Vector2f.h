@@ -1,5 +1,7 @@
 #pragma once
 
+#include "Maths.h"
+
 #include <iostream>
 
 #ifdef GDT_NAMESPACE
@@ -11,50 +13,52 @@ namespace GDT
     public:
         float x, y;
 
-        Vector2f();
-        Vector2f(float x, float y);
-        Vector2f(float xy);
+        constexpr Vector2f() : x(0), y(0) {}
+        constexpr Vector2f(float x, float y) : x(x), y(y) {}
+        constexpr Vector2f(float xy) : x(xy), y(xy) {}
 
-        void set(float x, float y);
-        void set(const Vector2f& v);
-        Vector2f& normalize();
+        GDT_CONSTEXPR14 void set(float x, float y);
+        GDT_CONSTEXPR14 void set(const Vector2f& v);
+        inline Vector2f& normalize();
 
-        float sqrMagnitude() const;
-        float length() const;
+        constexpr float sqrMagnitude() const;
+        inline float length() const;
 
         /* Operator overloads */
-        bool operator==(const Vector2f& v) const;
-        bool operator!=(const Vector2f& v) const;
-
-        Vector2f& operator+=(const Vector2f& v);
-        Vector2f& operator-=(const Vector2f& v);
-        Vector2f& operator*=(const Vector2f& v);
-        Vector2f& operator/=(const Vector2f& v);
-
-        Vector2f& operator+=(const float f);
-        Vector2f& operator-=(const float f);
-        Vector2f& operator*=(const float f);
-        Vector2f& operator/=(const float f);
-
-        Vector2f operator+(const Vector2f& v) const;
-        Vector2f operator-(const Vector2f& v) const;
-        Vector2f operator*(const Vector2f& v) const;
-        Vector2f operator/(const Vector2f& v) const;
-
-        Vector2f operator+(const float f);
-        Vector2f operator-(const float f);
-        Vector2f operator*(const float f);
-        Vector2f operator/(const float f);
-
-        Vector2f operator-() const;
+        constexpr bool operator==(const Vector2f& v) const;
+        constexpr bool operator!=(const Vector2f& v) const;
+
+        GDT_CONSTEXPR14 Vector2f& operator+=(const Vector2f& v);
+        GDT_CONSTEXPR14 Vector2f& operator-=(const Vector2f& v);
+        GDT_CONSTEXPR14 Vector2f& operator*=(const Vector2f& v);
+        GDT_CONSTEXPR14 Vector2f& operator/=(const Vector2f& v);
+
+        GDT_CONSTEXPR14 Vector2f& operator+=(const float f);
+        GDT_CONSTEXPR14 Vector2f& operator-=(const float f);
+        GDT_CONSTEXPR14 Vector2f& operator*=(const float f);
+        GDT_CONSTEXPR14 Vector2f& operator/=(const float f);
+
+        constexpr Vector2f operator+(const Vector2f& v) const;
+        constexpr Vector2f operator-(const Vector2f& v) const;
+        constexpr Vector2f operator*(const Vector2f& v) const;
+        constexpr Vector2f operator/(const Vector2f& v) const;
+
+        constexpr Vector2f operator+(const float f) const;
+        constexpr Vector2f operator-(const float f) const;
+        constexpr Vector2f operator*(const float f) const;
+        constexpr Vector2f operator/(const float f) const;
+
+        constexpr Vector2f operator-() const;
     };
 
-    float distance(const Vector2f& v1, const Vector2f& v2);
-    float dot(const Vector2f& v1, const Vector2f& v2);
-    Vector2f normalize(const Vector2f& v);
+    inline float distance(const Vector2f& v1, const Vector2f& v2);
+    constexpr float dot(const Vector2f& v1, const Vector2f& v2);
+    inline Vector2f normalize(const Vector2f& v);
     Vector2f pow(const Vector2f& v, float exponent);
 
     std::ostream& operator<<(std::ostream& os, const Vector2f& v);
 #ifdef GDT_NAMESPACE
 }
 #endif
+
+#include "Vector2f.inl"
@@ -0,0 +1,169 @@
+#include <cmath>
+
+#ifdef GDT_NAMESPACE
+namespace GDT
+{
+#endif
+    GDT_CONSTEXPR14 void Vector2f::set(float x, float y)
+    {
+        this->x = x;
+        this->y = y;
+    }
+
+    GDT_CONSTEXPR14 void Vector2f::set(const Vector2f& v)
+    {
+        set(v.x, v.y);
+    }
+
+    Vector2f& Vector2f::normalize()
+    {
+        float l = length();
+
+        x /= l;
+        y /= l;
+        return *this;
+    }
+
+    constexpr float Vector2f::sqrMagnitude() const
+    {
+        return x * x + y * y;
+    }
+
+    float Vector2f::length() const
+    {
+        return sqrt(sqrMagnitude());
+    }
+
+    /* Operator overloads */
+    constexpr bool Vector2f::operator==(const Vector2f& v) const
+    {
+        return x == v.x && y == v.y;
+    }
+
+    constexpr bool Vector2f::operator!=(const Vector2f& v) const
+    {
+        return x != v.x || y != v.y;
+    }
+
+    GDT_CONSTEXPR14 Vector2f& Vector2f::operator+=(const Vector2f& v)
+    {
+        x += v.x;
+        y += v.y;
+        return *this;
+    }
+
+    GDT_CONSTEXPR14 Vector2f& Vector2f::operator-=(const Vector2f& v)
+    {
+        x -= v.x;
+        y -= v.y;
+        return *this;
+    }
+
+    GDT_CONSTEXPR14 Vector2f& Vector2f::operator*=(const Vector2f& v)
+    {
+        x *= v.x;
+        y *= v.y;
+        return *this;
+    }
+
+    GDT_CONSTEXPR14 Vector2f& Vector2f::operator/=(const Vector2f& v)
+    {
+        x /= v.x;
+        y /= v.y;
+        return *this;
+    }
+
+    GDT_CONSTEXPR14 Vector2f& Vector2f::operator+=(const float f)
+    {
+        x += f;
+        y += f;
+        return *this;
+    }
+
+    GDT_CONSTEXPR14 Vector2f& Vector2f::operator-=(const float f)
+    {
+        x -= f;
+        y -= f;
+        return *this;
+    }
+
+    GDT_CONSTEXPR14 Vector2f& Vector2f::operator*=(const float f)
+    {
+        x *= f;
+        y *= f;
+        return *this;
+    }
+
+    GDT_CONSTEXPR14 Vector2f& Vector2f::operator/=(const float f)
+    {
+        x /= f;
+        y /= f;
+        return *this;
+    }
+
+
+    constexpr Vector2f Vector2f::operator+(const Vector2f& v) const
+    {
+        return Vector2f(x + v.x, y + v.y);
+    }
+
+    constexpr Vector2f Vector2f::operator-(const Vector2f& v) const
+    {
+        return Vector2f(x - v.x, y - v.y);
+    }
+
+    constexpr Vector2f Vector2f::operator*(const Vector2f& v) const
+    {
+        return Vector2f(x * v.x, y * v.y);
+    }
+
+    constexpr Vector2f Vector2f::operator/(const Vector2f& v) const
+    {
+        return Vector2f(x / v.x, y / v.y);
+    }
+
+
+    constexpr Vector2f Vector2f::operator+(const float f) const
+    {
+        return Vector2f(x + f, y + f);
+    }
+
+    constexpr Vector2f Vector2f::operator-(const float f) const
+    {
+        return Vector2f(x - f, y - f);
+    }
+
+    constexpr Vector2f Vector2f::operator*(const float f) const
+    {
+        return Vector2f(x * f, y * f);
+    }
+
+    constexpr Vector2f Vector2f::operator/(const float f) const
+    {
+        return Vector2f(x / f, y / f);
+    }
+
+    constexpr Vector2f Vector2f::operator-() const
+    {
+        return Vector2f(-x, -y);
+    }
+
+    float distance(const Vector2f& v1, const Vector2f& v2)
+    {
+        return (v2 - v1).length();
+    }
+
+    constexpr float dot(const Vector2f& v1, const Vector2f& v2)
+    {
+        return v1.x * v2.x + v1.y * v2.y;
+    }
+
+    Vector2f normalize(const Vector2f& v)
+    {
+        float l = v.length();
+
+        return Vector2f(v.x / l, v.y / l);
+    }
+#ifdef GDT_NAMESPACE
+}
+#endif
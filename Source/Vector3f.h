@@ -1,5 +1,8 @@
 #pragma once
 
+#include "Maths.h"
+
+#include <cstddef>
 #include <iostream>
 
 #ifdef GDT_NAMESPACE
@@ -14,52 +17,52 @@ namespace GDT
 
         float x, y, z;
 
-        Vector3f() : x(0), y(0), z(0) {}
-        Vector3f(float x, float y, float z) : x(x), y(y), z(z) {}
-        Vector3f(float xyz) : x(xyz), y(xyz), z(xyz) {}
+        constexpr Vector3f() : x(0), y(0), z(0) {}
+        constexpr Vector3f(float x, float y, float z) : x(x), y(y), z(z) {}
+        constexpr Vector3f(float xyz) : x(xyz), y(xyz), z(xyz) {}
 
-        inline void set(float x, float y, float z);
-        inline void set(const Vector3f& v);
+        GDT_CONSTEXPR14 void set(float x, float y, float z);
+        GDT_CONSTEXPR14 void set(const Vector3f& v);
         inline Vector3f& normalize();
 
-        inline float sqrMagnitude() const;
+        constexpr float sqrMagnitude() const;
         inline float length() const;
 
         /* Operator overloads */
-        inline bool operator==(const Vector3f& v) const;
-        inline bool operator!=(const Vector3f& v) const;
+        constexpr bool operator==(const Vector3f& v) const;
+        constexpr bool operator!=(const Vector3f& v) const;
         inline float& operator[](size_t pos);
         inline const float& operator[](size_t pos) const;
 
-        inline Vector3f& operator+=(const Vector3f& v);
-        inline Vector3f& operator-=(const Vector3f& v);
-        inline Vector3f& operator*=(const Vector3f& v);
-        inline Vector3f& operator/=(const Vector3f& v);
+        GDT_CONSTEXPR14 Vector3f& operator+=(const Vector3f& v);
+        GDT_CONSTEXPR14 Vector3f& operator-=(const Vector3f& v);
+        GDT_CONSTEXPR14 Vector3f& operator*=(const Vector3f& v);
+        GDT_CONSTEXPR14 Vector3f& operator/=(const Vector3f& v);
 
-        inline Vector3f& operator+=(const float f);
-        inline Vector3f& operator-=(const float f);
-        inline Vector3f& operator*=(const float f);
-        inline Vector3f& operator/=(const float f);
+        GDT_CONSTEXPR14 Vector3f& operator+=(const float f);
+        GDT_CONSTEXPR14 Vector3f& operator-=(const float f);
+        GDT_CONSTEXPR14 Vector3f& operator*=(const float f);
+        GDT_CONSTEXPR14 Vector3f& operator/=(const float f);
 
-        inline Vector3f operator+(const Vector3f& v) const;
-        inline Vector3f operator-(const Vector3f& v) const;
-        inline Vector3f operator*(const Vector3f& v) const;
-        inline Vector3f operator/(const Vector3f& v) const;
+        constexpr Vector3f operator+(const Vector3f& v) const;
+        constexpr Vector3f operator-(const Vector3f& v) const;
+        constexpr Vector3f operator*(const Vector3f& v) const;
+        constexpr Vector3f operator/(const Vector3f& v) const;
 
-        inline Vector3f operator+(const float f) const;
-        inline Vector3f operator-(const float f) const;
-        inline Vector3f operator*(const float f) const;
-        inline Vector3f operator/(const float f) const;
+        constexpr Vector3f operator+(const float f) const;
+        constexpr Vector3f operator-(const float f) const;
+        constexpr Vector3f operator*(const float f) const;
+        constexpr Vector3f operator/(const float f) const;
 
-        inline Vector3f operator-() const;
+        constexpr Vector3f operator-() const;
     };
 
-    float dot(const Vector3f& v1, const Vector3f& v2);
-    Vector3f cross(const Vector3f& v1, const Vector3f& v2);
-    Vector3f normalize(const Vector3f& v);
+    constexpr float dot(const Vector3f& v1, const Vector3f& v2);
+    constexpr Vector3f cross(const Vector3f& v1, const Vector3f& v2);
+    inline Vector3f normalize(const Vector3f& v);
     Vector3f pow(const Vector3f& v, float exponent);
-    float min(const Vector3f& v);
-    float max(const Vector3f& v);
+    constexpr float min(const Vector3f& v);
+    constexpr float max(const Vector3f& v);
 
     std::ostream& operator<<(std::ostream& os, const Vector3f& v);
 #ifdef GDT_NAMESPACE
@@ -1,170 +1,229 @@
+#include <cmath>
+#include <stdexcept>
 #include <string>
 
-void Vector3f::set(float x, float y, float z)
+#ifdef GDT_NAMESPACE
+namespace GDT
 {
-    this->x = x;
-    this->y = y;
-    this->z = z;
-}
+#endif
+    GDT_CONSTEXPR14 void Vector3f::set(float x, float y, float z)
+    {
+        this->x = x;
+        this->y = y;
+        this->z = z;
+    }
 
-void Vector3f::set(const Vector3f& v)
-{
-    set(v.x, v.y, v.z);
-}
+    GDT_CONSTEXPR14 void Vector3f::set(const Vector3f& v)
+    {
+        set(v.x, v.y, v.z);
+    }
 
-float Vector3f::sqrMagnitude() const
-{
-    return x * x + y * y + z * z;
-}
+    Vector3f& Vector3f::normalize()
+    {
+        const float epsilon = 0.00001f;
 
-float Vector3f::length() const
-{
-    return sqrt(sqrMagnitude());
-}
+        float len = length();
 
-/* Operator overloads */
-bool Vector3f::operator==(const Vector3f& v) const
-{
-    return x == v.x && y == v.y && z == v.z;
-}
+        float invl = 0;
+        if (len > epsilon)
+            invl = 1.0f / len;
 
-bool Vector3f::operator!=(const Vector3f& v) const
-{
-    return x != v.x || y != v.y || z != v.z;
-}
+        x *= invl;
+        y *= invl;
+        z *= invl;
 
-float& Vector3f::operator[](size_t pos)
-{
-    switch (pos)
+        return *this;
+    }
+
+    constexpr float Vector3f::sqrMagnitude() const
     {
-    case 0: return x;
-    case 1: return y;
-    case 2: return z;
+        return x * x + y * y + z * z;
     }
 
-    throw std::out_of_range(std::string("Attempting to access component ") + std::to_string(pos) + std::string(" of Vector3f, only [0-2] are defined."));
-}
+    float Vector3f::length() const
+    {
+        return sqrt(sqrMagnitude());
+    }
 
-const float& Vector3f::operator[](size_t pos) const
-{
-    switch (pos)
+    /* Operator overloads */
+    constexpr bool Vector3f::operator==(const Vector3f& v) const
     {
-    case 0: return x;
-    case 1: return y;
-    case 2: return z;
+        return x == v.x && y == v.y && z == v.z;
     }
-    throw std::out_of_range(std::string("Attempting to access component ") + std::to_string(pos) + std::string(" of Vector3f, only [0-2] are defined."));
-}
 
-Vector3f& Vector3f::operator+=(const Vector3f& v)
-{
-    x += v.x;
-    y += v.y;
-    z += v.z;
-    return *this;
-}
+    constexpr bool Vector3f::operator!=(const Vector3f& v) const
+    {
+        return x != v.x || y != v.y || z != v.z;
+    }
 
-Vector3f& Vector3f::operator-=(const Vector3f& v)
-{
-    x -= v.x;
-    y -= v.y;
-    z -= v.z;
-    return *this;
-}
+    float& Vector3f::operator[](size_t pos)
+    {
+        switch (pos)
+        {
+        case 0: return x;
+        case 1: return y;
+        case 2: return z;
+        }
+
+        throw std::out_of_range(std::string("Attempting to access component ") + std::to_string(pos) + std::string(" of Vector3f, only [0-2] are defined."));
+    }
 
-Vector3f& Vector3f::operator*=(const Vector3f& v)
-{
-    x *= v.x;
-    y *= v.y;
-    z *= v.z;
-    return *this;
-}
+    const float& Vector3f::operator[](size_t pos) const
+    {
+        switch (pos)
+        {
+        case 0: return x;
+        case 1: return y;
+        case 2: return z;
+        }
+        throw std::out_of_range(std::string("Attempting to access component ") + std::to_string(pos) + std::string(" of Vector3f, only [0-2] are defined."));
+    }
 
-Vector3f& Vector3f::operator/=(const Vector3f& v)
-{
-    x /= v.x;
-    y /= v.y;
-    z /= v.z;
-    return *this;
-}
+    GDT_CONSTEXPR14 Vector3f& Vector3f::operator+=(const Vector3f& v)
+    {
+        x += v.x;
+        y += v.y;
+        z += v.z;
+        return *this;
+    }
 
-Vector3f& Vector3f::operator+=(const float f)
-{
-    x += f;
-    y += f;
-    z += f;
-    return *this;
-}
+    GDT_CONSTEXPR14 Vector3f& Vector3f::operator-=(const Vector3f& v)
+    {
+        x -= v.x;
+        y -= v.y;
+        z -= v.z;
+        return *this;
+    }
 
-Vector3f& Vector3f::operator-=(const float f)
-{
-    x -= f;
-    y -= f;
-    z -= f;
-    return *this;
-}
+    GDT_CONSTEXPR14 Vector3f& Vector3f::operator*=(const Vector3f& v)
+    {
+        x *= v.x;
+        y *= v.y;
+        z *= v.z;
+        return *this;
+    }
 
-Vector3f& Vector3f::operator*=(const float f)
-{
-    x *= f;
-    y *= f;
-    z *= f;
-    return *this;
-}
+    GDT_CONSTEXPR14 Vector3f& Vector3f::operator/=(const Vector3f& v)
+    {
+        x /= v.x;
+        y /= v.y;
+        z /= v.z;
+        return *this;
+    }
 
-Vector3f& Vector3f::operator/=(const float f)
-{
-    float invf = 1.0f / f;
-    x *= invf;
-    y *= invf;
-    z *= invf;
-    return *this;
-}
+    GDT_CONSTEXPR14 Vector3f& Vector3f::operator+=(const float f)
+    {
+        x += f;
+        y += f;
+        z += f;
+        return *this;
+    }
 
+    GDT_CONSTEXPR14 Vector3f& Vector3f::operator-=(const float f)
+    {
+        x -= f;
+        y -= f;
+        z -= f;
+        return *this;
+    }
 
-Vector3f Vector3f::operator+(const Vector3f& v) const
-{
-    return Vector3f(x + v.x, y + v.y, z + v.z);
-}
+    GDT_CONSTEXPR14 Vector3f& Vector3f::operator*=(const float f)
+    {
+        x *= f;
+        y *= f;
+        z *= f;
+        return *this;
+    }
 
-Vector3f Vector3f::operator-(const Vector3f& v) const
-{
-    return Vector3f(x - v.x, y - v.y, z - v.z);
-}
+    GDT_CONSTEXPR14 Vector3f& Vector3f::operator/=(const float f)
+    {
+        float invf = 1.0f / f;
+        x *= invf;
+        y *= invf;
+        z *= invf;
+        return *this;
+    }
 
-Vector3f Vector3f::operator*(const Vector3f& v) const
-{
-    return Vector3f(x * v.x, y * v.y, z * v.z);
-}
 
-Vector3f Vector3f::operator/(const Vector3f& v) const
-{
-    return Vector3f(x / v.x, y / v.y, z / v.z);
-}
+    constexpr Vector3f Vector3f::operator+(const Vector3f& v) const
+    {
+        return Vector3f(x + v.x, y + v.y, z + v.z);
+    }
 
+    constexpr Vector3f Vector3f::operator-(const Vector3f& v) const
+    {
+        return Vector3f(x - v.x, y - v.y, z - v.z);
+    }
 
-Vector3f Vector3f::operator+(const float f) const
-{
-    return Vector3f(x + f, y + f, z + f);
-}
+    constexpr Vector3f Vector3f::operator*(const Vector3f& v) const
+    {
+        return Vector3f(x * v.x, y * v.y, z * v.z);
+    }
 
-Vector3f Vector3f::operator-(const float f) const
-{
-    return Vector3f(x - f, y - f, z - f);
-}
+    constexpr Vector3f Vector3f::operator/(const Vector3f& v) const
+    {
+        return Vector3f(x / v.x, y / v.y, z / v.z);
+    }
 
-Vector3f Vector3f::operator*(const float f) const
-{
-    return Vector3f(x * f, y * f, z * f);
-}
 
-Vector3f Vector3f::operator/(const float f) const
-{
-    float invf = 1.0f / f;
-    return Vector3f(x * invf, y * invf, z * invf);
-}
+    constexpr Vector3f Vector3f::operator+(const float f) const
+    {
+        return Vector3f(x + f, y + f, z + f);
+    }
 
-Vector3f Vector3f::operator-() const
-{
-    return Vector3f(-x, -y, -z);
+    constexpr Vector3f Vector3f::operator-(const float f) const
+    {
+        return Vector3f(x - f, y - f, z - f);
+    }
+
+    constexpr Vector3f Vector3f::operator*(const float f) const
+    {
+        return Vector3f(x * f, y * f, z * f);
+    }
+
+    constexpr Vector3f Vector3f::operator/(const float f) const
+    {
+        return *this * (1.0f / f);
+    }
+
+    constexpr Vector3f Vector3f::operator-() const
+    {
+        return Vector3f(-x, -y, -z);
+    }
+
+    constexpr float dot(const Vector3f& v1, const Vector3f& v2)
+    {
+        return v1.x * v2.x + v1.y * v2.y + v1.z * v2.z;
+    }
+
+    constexpr Vector3f cross(const Vector3f& v1, const Vector3f& v2)
+    {
+        return Vector3f(
+            v1.y * v2.z - v1.z * v2.y,
+            v2.x * v1.z - v2.z * v1.x,
+            v1.x * v2.y - v1.y * v2.x);
+    }
+
+    Vector3f normalize(const Vector3f& v)
+    {
+        const float epsilon = 0.00001f;
+
+        float len = v.length();
+        if (len > epsilon)
+            return v / len;
+
+        return Vector3f(0);
+    }
+
+    constexpr float min(const Vector3f& v)
+    {
+        return Math::min(v.x, Math::min(v.y, v.z));
+    }
+
+    constexpr float max(const Vector3f& v)
+    {
+        return Math::max(v.x, Math::max(v.y, v.z));
+    }
+#ifdef GDT_NAMESPACE
 }
+#endif
@@ -0,0 +1,239 @@
+#include "Vector3fSoA.h"
+
+#include "Vector3f.h"
+
+#include <stdexcept>
+#include <string>
+
+#ifdef GDT_NAMESPACE
+namespace GDT
+{
+#endif
+    namespace
+    {
+        const size_t PADDING = GDT_SIMD_ALIGNMENT / sizeof(float);
+
+        // Same threshold as Vector3f::normalize
+        const float EPSILON = 0.00001f;
+
+        void checkSize(const Vector3fSoA& v1, const Vector3fSoA& v2)
+        {
+            if (v1.size() != v2.size())
+            {
+                throw std::invalid_argument(std::string("Vector3fSoA sizes differ: ") + std::to_string(v1.size()) + std::string(" and ") + std::to_string(v2.size()));
+            }
+        }
+
+        template<typename Func>
+        void componentWise(const Vector3fSoA& v1, const Vector3fSoA& v2, Vector3fSoA& out, Func func)
+        {
+            checkSize(v1, v2);
+            out.resize(v1.size());
+
+            const AlignedFloatArray* in1[3] = { &v1.x, &v1.y, &v1.z };
+            const AlignedFloatArray* in2[3] = { &v2.x, &v2.y, &v2.z };
+            AlignedFloatArray* dest[3] = { &out.x, &out.y, &out.z };
+
+            size_t n = v1.paddedSize();
+            for (int c = 0; c < 3; c++)
+            {
+                const float* a = in1[c]->data();
+                const float* b = in2[c]->data();
+                float* d = dest[c]->data();
+                for (size_t i = 0; i < n; i += 4)
+                    Simd::store(d + i, func(Simd::load(a + i), Simd::load(b + i)));
+            }
+        }
+
+        Simd::Float4 dotAt(const Vector3fSoA& v1, const Vector3fSoA& v2, size_t i)
+        {
+            Simd::Float4 d = Simd::mul(Simd::load(&v1.x[i]), Simd::load(&v2.x[i]));
+            d = Simd::add(d, Simd::mul(Simd::load(&v1.y[i]), Simd::load(&v2.y[i])));
+            d = Simd::add(d, Simd::mul(Simd::load(&v1.z[i]), Simd::load(&v2.z[i])));
+            return d;
+        }
+    }
+
+    Vector3fSoA::Vector3fSoA() :
+        _size(0)
+    {
+
+    }
+
+    Vector3fSoA::Vector3fSoA(size_t size) :
+        _size(0)
+    {
+        resize(size);
+    }
+
+    Vector3fSoA::Vector3fSoA(const std::vector<Vector3f>& v) :
+        _size(0)
+    {
+        fromVector(v);
+    }
+
+    void Vector3fSoA::resize(size_t size)
+    {
+        size_t padded = (size + PADDING - 1) / PADDING * PADDING;
+
+        x.resize(padded);
+        y.resize(padded);
+        z.resize(padded);
+
+        // Keep the padding zeroed when shrinking, so kernels running over it stay finite
+        for (size_t i = size; i < padded; i++)
+        {
+            x[i] = 0;
+            y[i] = 0;
+            z[i] = 0;
+        }
+
+        _size = size;
+    }
+
+    void Vector3fSoA::clear()
+    {
+        resize(0);
+    }
+
+    size_t Vector3fSoA::size() const
+    {
+        return _size;
+    }
+
+    size_t Vector3fSoA::paddedSize() const
+    {
+        return x.size();
+    }
+
+    Vector3f Vector3fSoA::get(size_t i) const
+    {
+        return Vector3f(x[i], y[i], z[i]);
+    }
+
+    void Vector3fSoA::set(size_t i, const Vector3f& v)
+    {
+        x[i] = v.x;
+        y[i] = v.y;
+        z[i] = v.z;
+    }
+
+    void Vector3fSoA::fromVector(const std::vector<Vector3f>& v)
+    {
+        resize(v.size());
+
+        for (size_t i = 0; i < v.size(); i++)
+            set(i, v[i]);
+    }
+
+    std::vector<Vector3f> Vector3fSoA::toVector() const
+    {
+        std::vector<Vector3f> v(_size);
+
+        for (size_t i = 0; i < _size; i++)
+            v[i] = get(i);
+
+        return v;
+    }
+
+    void add(const Vector3fSoA& v1, const Vector3fSoA& v2, Vector3fSoA& out)
+    {
+        componentWise(v1, v2, out, [](Simd::Float4 a, Simd::Float4 b) { return Simd::add(a, b); });
+    }
+
+    void sub(const Vector3fSoA& v1, const Vector3fSoA& v2, Vector3fSoA& out)
+    {
+        componentWise(v1, v2, out, [](Simd::Float4 a, Simd::Float4 b) { return Simd::sub(a, b); });
+    }
+
+    void mul(const Vector3fSoA& v1, const Vector3fSoA& v2, Vector3fSoA& out)
+    {
+        componentWise(v1, v2, out, [](Simd::Float4 a, Simd::Float4 b) { return Simd::mul(a, b); });
+    }
+
+    void mul(const Vector3fSoA& v, float f, Vector3fSoA& out)
+    {
+        Simd::Float4 s = Simd::set1(f);
+        componentWise(v, v, out, [=](Simd::Float4 a, Simd::Float4) { return Simd::mul(a, s); });
+    }
+
+    void fma(const Vector3fSoA& v1, const Vector3fSoA& v2, const Vector3fSoA& v3, Vector3fSoA& out)
+    {
+        checkSize(v1, v2);
+        checkSize(v1, v3);
+        out.resize(v1.size());
+
+        size_t n = v1.paddedSize();
+        for (size_t i = 0; i < n; i += 4)
+        {
+            Simd::store(&out.x[i], Simd::add(Simd::mul(Simd::load(&v1.x[i]), Simd::load(&v2.x[i])), Simd::load(&v3.x[i])));
+            Simd::store(&out.y[i], Simd::add(Simd::mul(Simd::load(&v1.y[i]), Simd::load(&v2.y[i])), Simd::load(&v3.y[i])));
+            Simd::store(&out.z[i], Simd::add(Simd::mul(Simd::load(&v1.z[i]), Simd::load(&v2.z[i])), Simd::load(&v3.z[i])));
+        }
+    }
+
+    void fma(const Vector3fSoA& v1, float f, const Vector3fSoA& v3, Vector3fSoA& out)
+    {
+        Simd::Float4 s = Simd::set1(f);
+        componentWise(v1, v3, out, [=](Simd::Float4 a, Simd::Float4 c) { return Simd::add(Simd::mul(a, s), c); });
+    }
+
+    void dot(const Vector3fSoA& v1, const Vector3fSoA& v2, AlignedFloatArray& out)
+    {
+        checkSize(v1, v2);
+        out.resize(v1.paddedSize());
+
+        size_t n = v1.paddedSize();
+        for (size_t i = 0; i < n; i += 4)
+            Simd::store(&out[i], dotAt(v1, v2, i));
+    }
+
+    void cross(const Vector3fSoA& v1, const Vector3fSoA& v2, Vector3fSoA& out)
+    {
+        checkSize(v1, v2);
+        out.resize(v1.size());
+
+        size_t n = v1.paddedSize();
+        for (size_t i = 0; i < n; i += 4)
+        {
+            Simd::Float4 ax = Simd::load(&v1.x[i]), ay = Simd::load(&v1.y[i]), az = Simd::load(&v1.z[i]);
+            Simd::Float4 bx = Simd::load(&v2.x[i]), by = Simd::load(&v2.y[i]), bz = Simd::load(&v2.z[i]);
+
+            Simd::store(&out.x[i], Simd::sub(Simd::mul(ay, bz), Simd::mul(az, by)));
+            Simd::store(&out.y[i], Simd::sub(Simd::mul(bx, az), Simd::mul(bz, ax)));
+            Simd::store(&out.z[i], Simd::sub(Simd::mul(ax, by), Simd::mul(ay, bx)));
+        }
+    }
+
+    void normalize(const Vector3fSoA& v, Vector3fSoA& out)
+    {
+        out.resize(v.size());
+
+        Simd::Float4 one = Simd::set1(1.0f);
+        Simd::Float4 epsilon = Simd::set1(EPSILON);
+
+        size_t n = v.paddedSize();
+        for (size_t i = 0; i < n; i += 4)
+        {
+            Simd::Float4 len = Simd::sqrt(dotAt(v, v, i));
+
+            // Vectors shorter than epsilon become zero, as in normalize(const Vector3f&)
+            Simd::Float4 invLen = Simd::bitAnd(Simd::greaterThan(len, epsilon), Simd::div(one, len));
+
+            Simd::store(&out.x[i], Simd::mul(Simd::load(&v.x[i]), invLen));
+            Simd::store(&out.y[i], Simd::mul(Simd::load(&v.y[i]), invLen));
+            Simd::store(&out.z[i], Simd::mul(Simd::load(&v.z[i]), invLen));
+        }
+    }
+
+    void length(const Vector3fSoA& v, AlignedFloatArray& out)
+    {
+        out.resize(v.paddedSize());
+
+        size_t n = v.paddedSize();
+        for (size_t i = 0; i < n; i += 4)
+            Simd::store(&out[i], Simd::sqrt(dotAt(v, v, i)));
+    }
+#ifdef GDT_NAMESPACE
+}
+#endif
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "AlignedAllocator.h"
+
+#include <cstddef>
+#include <vector>
+
+#ifdef GDT_NAMESPACE
+namespace GDT
+{
+#endif
+    class Vector3f;
+
+    /**
+     * Structure-of-arrays container of 3D vectors. Every component is stored
+     * in its own aligned array, zero-padded to a multiple of the SIMD width so
+     * the bulk functions below process whole registers without a scalar tail.
+     */
+    class Vector3fSoA
+    {
+    public:
+        AlignedFloatArray x, y, z;
+
+        Vector3fSoA();
+        explicit Vector3fSoA(size_t size);
+        Vector3fSoA(const std::vector<Vector3f>& v);
+
+        void resize(size_t size);
+        void clear();
+
+        size_t size() const;
+        size_t paddedSize() const;
+
+        Vector3f get(size_t i) const;
+        void set(size_t i, const Vector3f& v);
+
+        void fromVector(const std::vector<Vector3f>& v);
+        std::vector<Vector3f> toVector() const;
+
+    private:
+        size_t _size;
+    };
+
+    /* Bulk operations, the output may alias any input and is resized to match it.
+       fma computes v1 * v2 + v3 with a separate multiply and add. */
+    void add(const Vector3fSoA& v1, const Vector3fSoA& v2, Vector3fSoA& out);
+    void sub(const Vector3fSoA& v1, const Vector3fSoA& v2, Vector3fSoA& out);
+    void mul(const Vector3fSoA& v1, const Vector3fSoA& v2, Vector3fSoA& out);
+    void mul(const Vector3fSoA& v, float f, Vector3fSoA& out);
+    void fma(const Vector3fSoA& v1, const Vector3fSoA& v2, const Vector3fSoA& v3, Vector3fSoA& out);
+    void fma(const Vector3fSoA& v1, float f, const Vector3fSoA& v3, Vector3fSoA& out);
+    void dot(const Vector3fSoA& v1, const Vector3fSoA& v2, AlignedFloatArray& out);
+    void cross(const Vector3fSoA& v1, const Vector3fSoA& v2, Vector3fSoA& out);
+    void normalize(const Vector3fSoA& v, Vector3fSoA& out);
+    void length(const Vector3fSoA& v, AlignedFloatArray& out);
+#ifdef GDT_NAMESPACE
+}
+#endif
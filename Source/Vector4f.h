@@ -1,13 +1,14 @@
 #pragma once
 
+#include "Vector3f.h"
+
+#include <cstddef>
 #include <iostream>
 
 #ifdef GDT_NAMESPACE
 namespace GDT
 {
 #endif
-    class Vector3f;
-
     class Vector4f
     {
     public:
@@ -20,55 +21,55 @@ namespace GDT
             float a[4];
         };
 
-        Vector4f();
-        Vector4f(float x, float y, float z, float w);
-        Vector4f(float xyz);
-        Vector4f(float xyz, float w);
-        Vector4f(Vector3f v, float w);
+        constexpr Vector4f() : a{ 0, 0, 0, 1 } {}
+        constexpr Vector4f(float x, float y, float z, float w) : a{ x, y, z, w } {}
+        constexpr Vector4f(float xyz) : a{ xyz, xyz, xyz, 1 } {}
+        constexpr Vector4f(float xyz, float w) : a{ xyz, xyz, xyz, w } {}
+        constexpr Vector4f(Vector3f v, float w) : a{ v.x, v.y, v.z, w } {}
 
-        inline void set(float x, float y, float z, float w);
-        inline void set(const Vector4f& v);
+        GDT_CONSTEXPR14 void set(float x, float y, float z, float w);
+        GDT_CONSTEXPR14 void set(const Vector4f& v);
         inline Vector4f& normalize();
 
-        inline float sqrMagnitude() const;
+        constexpr float sqrMagnitude() const;
         inline float length() const;
 
         /* Operator overloads */
-        inline bool operator==(const Vector4f& v) const;
-        inline bool operator!=(const Vector4f& v) const;
-        inline float& operator[](size_t pos);
-        inline const float& operator[](size_t pos) const;
-
-        inline Vector4f& operator+=(const Vector4f& v);
-        inline Vector4f& operator-=(const Vector4f& v);
-        inline Vector4f& operator*=(const Vector4f& v);
-        inline Vector4f& operator/=(const Vector4f& v);
-
-        inline Vector4f& operator+=(const float f);
-        inline Vector4f& operator-=(const float f);
-        inline Vector4f& operator*=(const float f);
-        inline Vector4f& operator/=(const float f);
-
-        inline Vector4f operator+(const Vector4f& v) const;
-        inline Vector4f operator-(const Vector4f& v) const;
-        inline Vector4f operator*(const Vector4f& v) const;
-        inline Vector4f operator/(const Vector4f& v) const;
-
-        inline Vector4f operator+(const float f);
-        inline Vector4f operator-(const float f);
-        inline Vector4f operator*(const float f);
-        inline Vector4f operator/(const float f);
-
-        inline Vector4f operator-() const;
+        constexpr bool operator==(const Vector4f& v) const;
+        constexpr bool operator!=(const Vector4f& v) const;
+        GDT_CONSTEXPR14 float& operator[](size_t pos);
+        constexpr const float& operator[](size_t pos) const;
+
+        GDT_CONSTEXPR14 Vector4f& operator+=(const Vector4f& v);
+        GDT_CONSTEXPR14 Vector4f& operator-=(const Vector4f& v);
+        GDT_CONSTEXPR14 Vector4f& operator*=(const Vector4f& v);
+        GDT_CONSTEXPR14 Vector4f& operator/=(const Vector4f& v);
+
+        GDT_CONSTEXPR14 Vector4f& operator+=(const float f);
+        GDT_CONSTEXPR14 Vector4f& operator-=(const float f);
+        GDT_CONSTEXPR14 Vector4f& operator*=(const float f);
+        GDT_CONSTEXPR14 Vector4f& operator/=(const float f);
+
+        constexpr Vector4f operator+(const Vector4f& v) const;
+        constexpr Vector4f operator-(const Vector4f& v) const;
+        constexpr Vector4f operator*(const Vector4f& v) const;
+        constexpr Vector4f operator/(const Vector4f& v) const;
+
+        constexpr Vector4f operator+(const float f) const;
+        constexpr Vector4f operator-(const float f) const;
+        constexpr Vector4f operator*(const float f) const;
+        constexpr Vector4f operator/(const float f) const;
+
+        constexpr Vector4f operator-() const;
     };
 
-    float dot(const Vector4f& v1, const Vector4f& v2);
-    Vector4f cross(const Vector4f& v1, const Vector4f& v2);
-    Vector4f normalize(const Vector4f& v);
+    constexpr float dot(const Vector4f& v1, const Vector4f& v2);
+    constexpr Vector4f cross(const Vector4f& v1, const Vector4f& v2);
+    inline Vector4f normalize(const Vector4f& v);
     Vector4f pow(const Vector4f& v, float exponent);
-    Vector4f mix(const Vector4f& v1, const Vector4f& v2, float a);
-    float min(const Vector4f& v);
-    float max(const Vector4f& v);
+    constexpr Vector4f mix(const Vector4f& v1, const Vector4f& v2, float a);
+    constexpr float min(const Vector4f& v);
+    constexpr float max(const Vector4f& v);
 
     std::ostream& operator<<(std::ostream& os, const Vector4f& v);
 #ifdef GDT_NAMESPACE
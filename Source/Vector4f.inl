@@ -1,165 +1,208 @@
-#include <string>
-
-void Vector4f::set(float x, float y, float z, float w)
-{
-    this->x = x;
-    this->y = y;
-    this->z = z;
-    this->w = w;
-}
-
-void Vector4f::set(const Vector4f& v)
-{
-    set(v.x, v.y, v.z, v.w);
-}
-
-Vector4f& Vector4f::normalize()
-{
-    float il = 1 / length();
-
-    x *= il;
-    y *= il;
-    z *= il;
-    return *this;
-}
-
-float Vector4f::sqrMagnitude() const
-{
-    return x * x + y * y + z * z;
-}
-
-float Vector4f::length() const
-{
-    return sqrt(sqrMagnitude());
-}
-
-/* Operator overloads */
-bool Vector4f::operator==(const Vector4f& v) const
-{
-    return x == v.x && y == v.y && z == v.z && w == v.w;
-}
-
-bool Vector4f::operator!=(const Vector4f& v) const
-{
-    return x != v.x || y != v.y || z != v.z || w != v.w;
-}
-
-float& Vector4f::operator[](size_t pos)
-{
-    return a[pos];
-}
-
-const float& Vector4f::operator[](size_t pos) const
-{
-    return a[pos];
-}
-
-Vector4f& Vector4f::operator+=(const Vector4f& v)
-{
-    x += v.x;
-    y += v.y;
-    z += v.z;
-    return *this;
-}
-
-Vector4f& Vector4f::operator-=(const Vector4f& v)
-{
-    x -= v.x;
-    y -= v.y;
-    z -= v.z;
-    return *this;
-}
-
-Vector4f& Vector4f::operator*=(const Vector4f& v)
-{
-    x *= v.x;
-    y *= v.y;
-    z *= v.z;
-    return *this;
-}
-
-Vector4f& Vector4f::operator/=(const Vector4f& v)
-{
-    x /= v.x;
-    y /= v.y;
-    z /= v.z;
-    return *this;
-}
-
-Vector4f& Vector4f::operator+=(const float f)
-{
-    x += f;
-    y += f;
-    z += f;
-    return *this;
-}
-
-Vector4f& Vector4f::operator-=(const float f)
-{
-    x -= f;
-    y -= f;
-    z -= f;
-    return *this;
-}
-
-Vector4f& Vector4f::operator*=(const float f)
-{
-    x *= f;
-    y *= f;
-    z *= f;
-    return *this;
-}
-
-Vector4f& Vector4f::operator/=(const float f)
-{
-    x /= f;
-    y /= f;
-    z /= f;
-    return *this;
-}
-
-
-Vector4f Vector4f::operator+(const Vector4f& v) const
-{
-    return Vector4f(x + v.x, y + v.y, z + v.z, w);
-}
-
-Vector4f Vector4f::operator-(const Vector4f& v) const
-{
-    return Vector4f(x - v.x, y - v.y, z - v.z, w);
-}
-
-Vector4f Vector4f::operator*(const Vector4f& v) const
-{
-    return Vector4f(x * v.x, y * v.y, z * v.z, w);
-}
-
-Vector4f Vector4f::operator/(const Vector4f& v) const
-{
-    return Vector4f(x / v.x, y / v.y, z / v.z, w);
-}
-
-Vector4f Vector4f::operator+(const float f)
-{
-    return Vector4f(x + f, y + f, z + f, w);
-}
-
-Vector4f Vector4f::operator-(const float f)
-{
-    return Vector4f(x - f, y - f, z - f, w);
-}
-
-Vector4f Vector4f::operator*(const float f)
-{
-    return Vector4f(x * f, y * f, z * f, w);
-}
-
-Vector4f Vector4f::operator/(const float f)
-{
-    return Vector4f(x / f, y / f, z / f, w);
-}
-
-Vector4f Vector4f::operator-() const
-{
-    return Vector4f(-x, -y, -z, w);
-}
+#include <cmath>
+
+#ifdef GDT_NAMESPACE
+namespace GDT
+{
+#endif
+    // Members are accessed through a, the member the constructors initialize, so they can be read in constant expressions
+    GDT_CONSTEXPR14 void Vector4f::set(float x, float y, float z, float w)
+    {
+        a[0] = x;
+        a[1] = y;
+        a[2] = z;
+        a[3] = w;
+    }
+
+    GDT_CONSTEXPR14 void Vector4f::set(const Vector4f& v)
+    {
+        set(v.a[0], v.a[1], v.a[2], v.a[3]);
+    }
+
+    Vector4f& Vector4f::normalize()
+    {
+        float il = 1 / length();
+
+        x *= il;
+        y *= il;
+        z *= il;
+        return *this;
+    }
+
+    constexpr float Vector4f::sqrMagnitude() const
+    {
+        return a[0] * a[0] + a[1] * a[1] + a[2] * a[2];
+    }
+
+    float Vector4f::length() const
+    {
+        return sqrt(sqrMagnitude());
+    }
+
+    /* Operator overloads */
+    constexpr bool Vector4f::operator==(const Vector4f& v) const
+    {
+        return a[0] == v.a[0] && a[1] == v.a[1] && a[2] == v.a[2] && a[3] == v.a[3];
+    }
+
+    constexpr bool Vector4f::operator!=(const Vector4f& v) const
+    {
+        return a[0] != v.a[0] || a[1] != v.a[1] || a[2] != v.a[2] || a[3] != v.a[3];
+    }
+
+    GDT_CONSTEXPR14 float& Vector4f::operator[](size_t pos)
+    {
+        return a[pos];
+    }
+
+    constexpr const float& Vector4f::operator[](size_t pos) const
+    {
+        return a[pos];
+    }
+
+    GDT_CONSTEXPR14 Vector4f& Vector4f::operator+=(const Vector4f& v)
+    {
+        a[0] += v.a[0];
+        a[1] += v.a[1];
+        a[2] += v.a[2];
+        return *this;
+    }
+
+    GDT_CONSTEXPR14 Vector4f& Vector4f::operator-=(const Vector4f& v)
+    {
+        a[0] -= v.a[0];
+        a[1] -= v.a[1];
+        a[2] -= v.a[2];
+        return *this;
+    }
+
+    GDT_CONSTEXPR14 Vector4f& Vector4f::operator*=(const Vector4f& v)
+    {
+        a[0] *= v.a[0];
+        a[1] *= v.a[1];
+        a[2] *= v.a[2];
+        return *this;
+    }
+
+    GDT_CONSTEXPR14 Vector4f& Vector4f::operator/=(const Vector4f& v)
+    {
+        a[0] /= v.a[0];
+        a[1] /= v.a[1];
+        a[2] /= v.a[2];
+        return *this;
+    }
+
+    GDT_CONSTEXPR14 Vector4f& Vector4f::operator+=(const float f)
+    {
+        a[0] += f;
+        a[1] += f;
+        a[2] += f;
+        return *this;
+    }
+
+    GDT_CONSTEXPR14 Vector4f& Vector4f::operator-=(const float f)
+    {
+        a[0] -= f;
+        a[1] -= f;
+        a[2] -= f;
+        return *this;
+    }
+
+    GDT_CONSTEXPR14 Vector4f& Vector4f::operator*=(const float f)
+    {
+        a[0] *= f;
+        a[1] *= f;
+        a[2] *= f;
+        return *this;
+    }
+
+    GDT_CONSTEXPR14 Vector4f& Vector4f::operator/=(const float f)
+    {
+        a[0] /= f;
+        a[1] /= f;
+        a[2] /= f;
+        return *this;
+    }
+
+    constexpr Vector4f Vector4f::operator+(const Vector4f& v) const
+    {
+        return Vector4f(a[0] + v.a[0], a[1] + v.a[1], a[2] + v.a[2], a[3]);
+    }
+
+    constexpr Vector4f Vector4f::operator-(const Vector4f& v) const
+    {
+        return Vector4f(a[0] - v.a[0], a[1] - v.a[1], a[2] - v.a[2], a[3]);
+    }
+
+    constexpr Vector4f Vector4f::operator*(const Vector4f& v) const
+    {
+        return Vector4f(a[0] * v.a[0], a[1] * v.a[1], a[2] * v.a[2], a[3]);
+    }
+
+    constexpr Vector4f Vector4f::operator/(const Vector4f& v) const
+    {
+        return Vector4f(a[0] / v.a[0], a[1] / v.a[1], a[2] / v.a[2], a[3]);
+    }
+
+    constexpr Vector4f Vector4f::operator+(const float f) const
+    {
+        return Vector4f(a[0] + f, a[1] + f, a[2] + f, a[3]);
+    }
+
+    constexpr Vector4f Vector4f::operator-(const float f) const
+    {
+        return Vector4f(a[0] - f, a[1] - f, a[2] - f, a[3]);
+    }
+
+    constexpr Vector4f Vector4f::operator*(const float f) const
+    {
+        return Vector4f(a[0] * f, a[1] * f, a[2] * f, a[3]);
+    }
+
+    constexpr Vector4f Vector4f::operator/(const float f) const
+    {
+        return Vector4f(a[0] / f, a[1] / f, a[2] / f, a[3]);
+    }
+
+    constexpr Vector4f Vector4f::operator-() const
+    {
+        return Vector4f(-a[0], -a[1], -a[2], a[3]);
+    }
+
+    constexpr float dot(const Vector4f& v1, const Vector4f& v2)
+    {
+        return v1.a[0] * v2.a[0] + v1.a[1] * v2.a[1] + v1.a[2] * v2.a[2];
+    }
+
+    constexpr Vector4f cross(const Vector4f& v1, const Vector4f& v2)
+    {
+        return Vector4f(
+            v1.a[1] * v2.a[2] - v1.a[2] * v2.a[1],
+            v2.a[0] * v1.a[2] - v2.a[2] * v1.a[0],
+            v1.a[0] * v2.a[1] - v1.a[1] * v2.a[0],
+            v1.a[3]);
+    }
+
+    Vector4f normalize(const Vector4f& v)
+    {
+        float l = v.length();
+
+        return Vector4f(v.x / l, v.y / l, v.z / l, v.w);
+    }
+
+    constexpr Vector4f mix(const Vector4f& v1, const Vector4f& v2, float a)
+    {
+        return v1 * (1 - a) + v2 * a;
+    }
+
+    constexpr float min(const Vector4f& v)
+    {
+        return Math::min(v.a[0], Math::min(v.a[1], v.a[2]));
+    }
+
+    constexpr float max(const Vector4f& v)
+    {
+        return Math::max(v.a[0], Math::max(v.a[1], v.a[2]));
+    }
+#ifdef GDT_NAMESPACE
+}
+#endif
@@ -0,0 +1,252 @@
+#include "Vector4fSoA.h"
+
+#include "Vector4f.h"
+
+#include <stdexcept>
+#include <string>
+
+#ifdef GDT_NAMESPACE
+namespace GDT
+{
+#endif
+    namespace
+    {
+        const size_t PADDING = GDT_SIMD_ALIGNMENT / sizeof(float);
+
+        void checkSize(const Vector4fSoA& v1, const Vector4fSoA& v2)
+        {
+            if (v1.size() != v2.size())
+            {
+                throw std::invalid_argument(std::string("Vector4fSoA sizes differ: ") + std::to_string(v1.size()) + std::string(" and ") + std::to_string(v2.size()));
+            }
+        }
+
+        void copyW(const Vector4fSoA& v, Vector4fSoA& out)
+        {
+            if (&v != &out)
+                out.w = v.w;
+        }
+
+        template<typename Func>
+        void componentWise(const Vector4fSoA& v1, const Vector4fSoA& v2, Vector4fSoA& out, Func func)
+        {
+            checkSize(v1, v2);
+            out.resize(v1.size());
+
+            const AlignedFloatArray* in1[3] = { &v1.x, &v1.y, &v1.z };
+            const AlignedFloatArray* in2[3] = { &v2.x, &v2.y, &v2.z };
+            AlignedFloatArray* dest[3] = { &out.x, &out.y, &out.z };
+
+            size_t n = v1.paddedSize();
+            for (int c = 0; c < 3; c++)
+            {
+                const float* a = in1[c]->data();
+                const float* b = in2[c]->data();
+                float* d = dest[c]->data();
+                for (size_t i = 0; i < n; i += 4)
+                    Simd::store(d + i, func(Simd::load(a + i), Simd::load(b + i)));
+            }
+
+            copyW(v1, out);
+        }
+
+        Simd::Float4 dotAt(const Vector4fSoA& v1, const Vector4fSoA& v2, size_t i)
+        {
+            Simd::Float4 d = Simd::mul(Simd::load(&v1.x[i]), Simd::load(&v2.x[i]));
+            d = Simd::add(d, Simd::mul(Simd::load(&v1.y[i]), Simd::load(&v2.y[i])));
+            d = Simd::add(d, Simd::mul(Simd::load(&v1.z[i]), Simd::load(&v2.z[i])));
+            return d;
+        }
+    }
+
+    Vector4fSoA::Vector4fSoA() :
+        _size(0)
+    {
+
+    }
+
+    Vector4fSoA::Vector4fSoA(size_t size) :
+        _size(0)
+    {
+        resize(size);
+    }
+
+    Vector4fSoA::Vector4fSoA(const std::vector<Vector4f>& v) :
+        _size(0)
+    {
+        fromVector(v);
+    }
+
+    void Vector4fSoA::resize(size_t size)
+    {
+        size_t padded = (size + PADDING - 1) / PADDING * PADDING;
+
+        x.resize(padded);
+        y.resize(padded);
+        z.resize(padded);
+        w.resize(padded);
+
+        // Keep the padding zeroed when shrinking, so kernels running over it stay finite
+        for (size_t i = size; i < padded; i++)
+        {
+            x[i] = 0;
+            y[i] = 0;
+            z[i] = 0;
+            w[i] = 0;
+        }
+
+        _size = size;
+    }
+
+    void Vector4fSoA::clear()
+    {
+        resize(0);
+    }
+
+    size_t Vector4fSoA::size() const
+    {
+        return _size;
+    }
+
+    size_t Vector4fSoA::paddedSize() const
+    {
+        return x.size();
+    }
+
+    Vector4f Vector4fSoA::get(size_t i) const
+    {
+        return Vector4f(x[i], y[i], z[i], w[i]);
+    }
+
+    void Vector4fSoA::set(size_t i, const Vector4f& v)
+    {
+        x[i] = v.x;
+        y[i] = v.y;
+        z[i] = v.z;
+        w[i] = v.w;
+    }
+
+    void Vector4fSoA::fromVector(const std::vector<Vector4f>& v)
+    {
+        resize(v.size());
+
+        for (size_t i = 0; i < v.size(); i++)
+            set(i, v[i]);
+    }
+
+    std::vector<Vector4f> Vector4fSoA::toVector() const
+    {
+        std::vector<Vector4f> v(_size);
+
+        for (size_t i = 0; i < _size; i++)
+            v[i] = get(i);
+
+        return v;
+    }
+
+    void add(const Vector4fSoA& v1, const Vector4fSoA& v2, Vector4fSoA& out)
+    {
+        componentWise(v1, v2, out, [](Simd::Float4 a, Simd::Float4 b) { return Simd::add(a, b); });
+    }
+
+    void sub(const Vector4fSoA& v1, const Vector4fSoA& v2, Vector4fSoA& out)
+    {
+        componentWise(v1, v2, out, [](Simd::Float4 a, Simd::Float4 b) { return Simd::sub(a, b); });
+    }
+
+    void mul(const Vector4fSoA& v1, const Vector4fSoA& v2, Vector4fSoA& out)
+    {
+        componentWise(v1, v2, out, [](Simd::Float4 a, Simd::Float4 b) { return Simd::mul(a, b); });
+    }
+
+    void mul(const Vector4fSoA& v, float f, Vector4fSoA& out)
+    {
+        Simd::Float4 s = Simd::set1(f);
+        componentWise(v, v, out, [=](Simd::Float4 a, Simd::Float4) { return Simd::mul(a, s); });
+    }
+
+    void fma(const Vector4fSoA& v1, const Vector4fSoA& v2, const Vector4fSoA& v3, Vector4fSoA& out)
+    {
+        checkSize(v1, v2);
+        checkSize(v1, v3);
+        out.resize(v1.size());
+
+        size_t n = v1.paddedSize();
+        for (size_t i = 0; i < n; i += 4)
+        {
+            Simd::store(&out.x[i], Simd::add(Simd::mul(Simd::load(&v1.x[i]), Simd::load(&v2.x[i])), Simd::load(&v3.x[i])));
+            Simd::store(&out.y[i], Simd::add(Simd::mul(Simd::load(&v1.y[i]), Simd::load(&v2.y[i])), Simd::load(&v3.y[i])));
+            Simd::store(&out.z[i], Simd::add(Simd::mul(Simd::load(&v1.z[i]), Simd::load(&v2.z[i])), Simd::load(&v3.z[i])));
+        }
+
+        copyW(v1, out);
+    }
+
+    void fma(const Vector4fSoA& v1, float f, const Vector4fSoA& v3, Vector4fSoA& out)
+    {
+        Simd::Float4 s = Simd::set1(f);
+        componentWise(v1, v3, out, [=](Simd::Float4 a, Simd::Float4 c) { return Simd::add(Simd::mul(a, s), c); });
+    }
+
+    void dot(const Vector4fSoA& v1, const Vector4fSoA& v2, AlignedFloatArray& out)
+    {
+        checkSize(v1, v2);
+        out.resize(v1.paddedSize());
+
+        size_t n = v1.paddedSize();
+        for (size_t i = 0; i < n; i += 4)
+            Simd::store(&out[i], dotAt(v1, v2, i));
+    }
+
+    void cross(const Vector4fSoA& v1, const Vector4fSoA& v2, Vector4fSoA& out)
+    {
+        checkSize(v1, v2);
+        out.resize(v1.size());
+
+        size_t n = v1.paddedSize();
+        for (size_t i = 0; i < n; i += 4)
+        {
+            Simd::Float4 ax = Simd::load(&v1.x[i]), ay = Simd::load(&v1.y[i]), az = Simd::load(&v1.z[i]);
+            Simd::Float4 bx = Simd::load(&v2.x[i]), by = Simd::load(&v2.y[i]), bz = Simd::load(&v2.z[i]);
+
+            Simd::store(&out.x[i], Simd::sub(Simd::mul(ay, bz), Simd::mul(az, by)));
+            Simd::store(&out.y[i], Simd::sub(Simd::mul(bx, az), Simd::mul(bz, ax)));
+            Simd::store(&out.z[i], Simd::sub(Simd::mul(ax, by), Simd::mul(ay, bx)));
+        }
+
+        copyW(v1, out);
+    }
+
+    void normalize(const Vector4fSoA& v, Vector4fSoA& out)
+    {
+        out.resize(v.size());
+
+        Simd::Float4 zero = Simd::set1(0.0f);
+
+        size_t n = v.paddedSize();
+        for (size_t i = 0; i < n; i += 4)
+        {
+            // Divides by the length like normalize(const Vector4f&), but zero
+            // length vectors stay zero instead of becoming NaN
+            Simd::Float4 len = Simd::sqrt(dotAt(v, v, i));
+            Simd::Float4 nonZero = Simd::greaterThan(len, zero);
+
+            Simd::store(&out.x[i], Simd::bitAnd(nonZero, Simd::div(Simd::load(&v.x[i]), len)));
+            Simd::store(&out.y[i], Simd::bitAnd(nonZero, Simd::div(Simd::load(&v.y[i]), len)));
+            Simd::store(&out.z[i], Simd::bitAnd(nonZero, Simd::div(Simd::load(&v.z[i]), len)));
+        }
+
+        copyW(v, out);
+    }
+
+    void length(const Vector4fSoA& v, AlignedFloatArray& out)
+    {
+        out.resize(v.paddedSize());
+
+        size_t n = v.paddedSize();
+        for (size_t i = 0; i < n; i += 4)
+            Simd::store(&out[i], Simd::sqrt(dotAt(v, v, i)));
+    }
+#ifdef GDT_NAMESPACE
+}
+#endif
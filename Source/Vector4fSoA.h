@@ -0,0 +1,61 @@
+#pragma once
+
+#include "AlignedAllocator.h"
+
+#include <cstddef>
+#include <vector>
+
+#ifdef GDT_NAMESPACE
+namespace GDT
+{
+#endif
+    class Vector4f;
+
+    /**
+     * Structure-of-arrays container of 4D vectors. Every component is stored
+     * in its own aligned array, zero-padded to a multiple of the SIMD width so
+     * the bulk functions below process whole registers without a scalar tail.
+     *
+     * The operations follow the semantics of Vector4f: they act on x, y and z
+     * and carry over w from the first operand.
+     */
+    class Vector4fSoA
+    {
+    public:
+        AlignedFloatArray x, y, z, w;
+
+        Vector4fSoA();
+        explicit Vector4fSoA(size_t size);
+        Vector4fSoA(const std::vector<Vector4f>& v);
+
+        void resize(size_t size);
+        void clear();
+
+        size_t size() const;
+        size_t paddedSize() const;
+
+        Vector4f get(size_t i) const;
+        void set(size_t i, const Vector4f& v);
+
+        void fromVector(const std::vector<Vector4f>& v);
+        std::vector<Vector4f> toVector() const;
+
+    private:
+        size_t _size;
+    };
+
+    /* Bulk operations, the output may alias any input and is resized to match it.
+       fma computes v1 * v2 + v3 with a separate multiply and add. */
+    void add(const Vector4fSoA& v1, const Vector4fSoA& v2, Vector4fSoA& out);
+    void sub(const Vector4fSoA& v1, const Vector4fSoA& v2, Vector4fSoA& out);
+    void mul(const Vector4fSoA& v1, const Vector4fSoA& v2, Vector4fSoA& out);
+    void mul(const Vector4fSoA& v, float f, Vector4fSoA& out);
+    void fma(const Vector4fSoA& v1, const Vector4fSoA& v2, const Vector4fSoA& v3, Vector4fSoA& out);
+    void fma(const Vector4fSoA& v1, float f, const Vector4fSoA& v3, Vector4fSoA& out);
+    void dot(const Vector4fSoA& v1, const Vector4fSoA& v2, AlignedFloatArray& out);
+    void cross(const Vector4fSoA& v1, const Vector4fSoA& v2, Vector4fSoA& out);
+    void normalize(const Vector4fSoA& v, Vector4fSoA& out);
+    void length(const Vector4fSoA& v, AlignedFloatArray& out);
+#ifdef GDT_NAMESPACE
+}
+#endif
@@ -1,6 +1,7 @@
 #include "Window.h"
 
 #include "OpenGL.h"
+#include "Extensions.h"
 #include <GLFW/glfw3.h>
 
 #include <algorithm>
@@ -103,6 +104,7 @@ namespace GDT
 
         glfwMakeContextCurrent(window);
         gladLoadGLLoader((GLADloadproc)glfwGetProcAddress);
+        Extensions::load((GLADloadproc)glfwGetProcAddress);
 
         glfwSwapInterval(1);
 
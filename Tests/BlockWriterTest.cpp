@@ -0,0 +1,91 @@
+#include "BlockWriter.h"
+#include "Vector3f.h"
+#include "Vector4f.h"
+
+#include <cstdio>
+#include <stdexcept>
+#include <vector>
+
+#ifdef GDT_NAMESPACE
+using namespace GDT;
+#endif
+
+// Checks that the memory of a BlockWriter holds the getSize() bytes a
+// buffer upload reads from it, including the padding std140 rounds to.
+// Build with a sanitizer to catch reads past the end as well.
+namespace
+{
+    int failures = 0;
+
+    void check(bool condition, const char* what)
+    {
+        if (!condition)
+        {
+            printf("Failed: %s\n", what);
+            failures++;
+        }
+    }
+
+    // Copies getSize() bytes like an upload would, the padding of the owned memory is zero
+    bool isBackedAndZeroPadded(const BlockWriter& writer, size_t written)
+    {
+        const unsigned char* data = writer.getData();
+        std::vector<unsigned char> copy(data, data + writer.getSize());
+
+        for (size_t i = written; i < copy.size(); i++)
+        {
+            if (copy[i] != 0)
+                return false;
+        }
+        return true;
+    }
+}
+
+int main()
+{
+    BlockWriter scalar(BlockLayout::STD140);
+    scalar.write(1.0f);
+    check(scalar.getSize() == 16, "a std140 block of one float is 16 bytes");
+    check(isBackedAndZeroPadded(scalar, 4), "a std140 block of one float is backed");
+
+    BlockWriter vector(BlockLayout::STD140);
+    vector.write(Vector3f(1, 2, 3));
+    check(vector.getSize() == 16, "a std140 block of one vec3 is 16 bytes");
+    check(isBackedAndZeroPadded(vector, 12), "a std140 block of one vec3 is backed");
+
+    BlockWriter seeked(BlockLayout::STD140);
+    seeked.write(1.0f);
+    seeked.seek(36);
+    check(seeked.getSize() == 48, "a std140 block seeked to 36 is 48 bytes");
+    check(isBackedAndZeroPadded(seeked, 4), "a std140 block seeked past its end is backed");
+
+    BlockWriter packed(BlockLayout::STD430);
+    packed.write(1.0f).seek(10);
+    check(packed.getSize() == 10, "a std430 block is not padded");
+    check(isBackedAndZeroPadded(packed, 4), "a std430 block seeked past its end is backed");
+
+    // Destination memory cannot grow, so a block whose padding does not fit is rejected
+    unsigned char memory[20] = {};
+    BlockWriter destination(BlockLayout::STD140, memory, sizeof(memory));
+    destination.write(Vector4f(1, 2, 3, 4));
+    bool threw = false;
+    try
+    {
+        destination.write(1.0f);
+    }
+    catch (const std::out_of_range&)
+    {
+        threw = true;
+    }
+    check(threw, "a std140 write whose padding exceeds the destination throws");
+    check(destination.getSize() <= sizeof(memory), "a destination holds the size of its block");
+
+    if (failures > 0)
+    {
+        printf("%d checks failed\n", failures);
+        return 1;
+    }
+
+    printf("Block memory holds the size of every block\n");
+    return 0;
+}
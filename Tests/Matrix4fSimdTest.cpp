@@ -0,0 +1,99 @@
+#include "Matrix4f.h"
+#include "Vector4f.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#ifdef GDT_NAMESPACE
+using namespace GDT;
+#endif
+
+// Checks that the products of the SIMD backend the library was built with
+// are bit-identical to those of the scalar fallback. The reference below
+// repeats the scalar code of Matrix4f.inl, summing the terms left to right.
+namespace
+{
+    uint32_t state = 12345;
+
+    float nextFloat()
+    {
+        state = state * 1664525u + 1013904223u;
+        return (float) ((int32_t) (state >> 8) - (1 << 23)) / (1 << 16);
+    }
+
+    Matrix4f randomMatrix()
+    {
+        Matrix4f m;
+        for (int i = 0; i < 16; i++)
+            m[i] = nextFloat();
+        return m;
+    }
+
+    Matrix4f multiplyScalar(const Matrix4f& a, const Matrix4f& b)
+    {
+        Matrix4f dest;
+        for (int c = 0; c < 4; c++)
+        {
+            for (int r = 0; r < 4; r++)
+                dest[c * 4 + r] = a[r] * b[c * 4] + a[4 + r] * b[c * 4 + 1] + a[8 + r] * b[c * 4 + 2] + a[12 + r] * b[c * 4 + 3];
+        }
+        return dest;
+    }
+
+    Vector4f multiplyScalar(const Matrix4f& a, const Vector4f& v)
+    {
+        Vector4f dest;
+        dest.x = a[0] * v.x + a[4] * v.y + a[8] * v.z + a[12] * v.w;
+        dest.y = a[1] * v.x + a[5] * v.y + a[9] * v.z + a[13] * v.w;
+        dest.z = a[2] * v.x + a[6] * v.y + a[10] * v.z + a[14] * v.w;
+        dest.w = a[3] * v.x + a[7] * v.y + a[11] * v.z + a[15] * v.w;
+        return dest;
+    }
+
+    bool sameBits(const float* a, const float* b, size_t count)
+    {
+        return memcmp(a, b, count * sizeof(float)) == 0;
+    }
+}
+
+int main()
+{
+    const int ITERATIONS = 100000;
+
+    int failures = 0;
+    for (int i = 0; i < ITERATIONS; i++)
+    {
+        Matrix4f a = randomMatrix();
+        Matrix4f b = randomMatrix();
+        Vector4f v(nextFloat(), nextFloat(), nextFloat(), nextFloat());
+
+        Matrix4f product = a * b;
+        Matrix4f expected = multiplyScalar(a, b);
+        if (!sameBits(product.toArray(), expected.toArray(), 16))
+        {
+            if (failures++ < 10)
+                printf("Matrix4f * Matrix4f differs from the scalar path:\n%s\n%s\n", product.str().c_str(), expected.str().c_str());
+        }
+
+        Vector4f transformed = a * v;
+        Vector4f expectedVector = multiplyScalar(a, v);
+        float t[4] = { transformed.x, transformed.y, transformed.z, transformed.w };
+        float e[4] = { expectedVector.x, expectedVector.y, expectedVector.z, expectedVector.w };
+        if (!sameBits(t, e, 4))
+        {
+            if (failures++ < 10)
+                printf("Matrix4f * Vector4f differs from the scalar path: (%g, %g, %g, %g) and (%g, %g, %g, %g)\n",
+                    t[0], t[1], t[2], t[3], e[0], e[1], e[2], e[3]);
+        }
+    }
+
+    if (failures > 0)
+    {
+        printf("%d of %d products differ\n", failures, 2 * ITERATIONS);
+        return 1;
+    }
+
+    printf("%d products match the scalar path\n", 2 * ITERATIONS);
+    return 0;
+}